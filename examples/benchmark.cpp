@@ -0,0 +1,522 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+// #define RAPBTL_NO_STD_CPLUSPLUS
+#include <junction/association/collection/safe.hpp>
+#include <junction/association/selection/safe.hpp>
+#include <junction/collection/safe.hpp>
+#include <junction/provision/contraction/safe.hpp>
+#include <junction/provision/contribution/safe.hpp>
+#include <junction/provision/elevation/safe.hpp>
+#include <junction/selection/safe.hpp>
+#include <junction/stdlib.hpp>
+#include <procession.hpp>
+#include <ration/association/collection.hpp>
+#include <ration/association/selection.hpp>
+#include <ration/collection.hpp>
+#include <ration/contraction.hpp>
+#include <ration/contribution.hpp>
+#include <ration/elevation.hpp>
+#include <ration/selection.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#else
+extern "C" {
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+}
+#endif
+
+using namespace ::location;
+using namespace ::trajection;
+using namespace ::traction;
+using namespace ::attribution;
+using namespace ::composition;
+using namespace ::association;
+using namespace ::procession;
+using namespace ::comparison;
+using MapComplementary = Complementary<int, int>;
+using ListAdjunctive = ::junction::DoublyAdjunctive<unsigned, int>;
+using MapAdjunctive = ::junction::DoublyAdjunctive<unsigned, MapComplementary>;
+constexpr ListAdjunctive ListAdjunct = ::junction::stdlib::DefaultMallocDoubleAdjunct<unsigned, int>;
+constexpr MapAdjunctive MapAdjunct = ::junction::stdlib::DefaultMallocDoubleAdjunct<unsigned, MapComplementary>;
+constexpr unsigned long Operations = 0x4000;
+
+struct Designative {
+
+    Locational<const char>
+        suite;
+
+    Locational<const char>
+        structure;
+
+    Locational<const char>
+        table;
+};
+
+static bool Notated = false;
+static bool Reported = false;
+static volatile unsigned long Tally = 0;
+
+static inline unsigned long long
+Now()
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#else
+    return static_cast<unsigned long long>(clock()) * (1000000000ull / CLOCKS_PER_SEC);
+#endif
+}
+
+static inline int
+Scramble(
+    unsigned
+        index,
+    unsigned
+        size)
+{
+    return static_cast<int>((index * 0x9E3779B1u) & (size - 1));
+}
+
+static inline unsigned
+Rounds(unsigned size)
+{
+    return Operations / size > 0 ? Operations / size : 1;
+}
+
+static void
+Report(
+    Referential<const Designative>
+        designation,
+    const Locational<const char>
+        operation,
+    unsigned
+        size,
+    unsigned long
+        count,
+    unsigned long long
+        nanoseconds)
+{
+    const double average = count ? static_cast<double>(nanoseconds) / count : 0;
+    if (Notated) {
+        printf("%s\n  {\"suite\": \"%s\", \"structure\": \"%s\", \"table\": \"%s\", \"operation\": \"%s\", "
+               "\"size\": %u, \"operations\": %lu, \"nanoseconds\": %llu, \"nanoseconds_per_operation\": %.2f}",
+            Reported ? "," : "[", designation.suite, designation.structure, designation.table, operation, size, count, nanoseconds, average);
+    } else {
+        if (!Reported)
+            puts("suite,structure,table,operation,size,operations,nanoseconds,nanoseconds_per_operation");
+        printf("%s,%s,%s,%s,%u,%lu,%llu,%.2f\n", designation.suite, designation.structure, designation.table, operation, size, count, nanoseconds, average);
+    }
+    Reported = true;
+}
+
+template <
+    typename Spatial,
+    typename Natural>
+static void
+MeasureComposition(
+    Referential<Spatial>
+        set,
+    Referential<const Compositional<Spatial, Natural, int>>
+        composer,
+    Referential<const Designative>
+        designation,
+    unsigned
+        size)
+{
+    const unsigned rounds = Rounds(size);
+    unsigned long long composing, accrediting, discomposing, start;
+    unsigned round, index;
+    composing = accrediting = discomposing = 0;
+    composer.decompose(set);
+    for (round = 0; round < rounds; round++) {
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += composer.compose(set, Scramble(index, size));
+        composing += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += composer.accredit(set, Scramble(index + round, size));
+        accrediting += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += composer.discompose(set, Scramble(index, size));
+        discomposing += Now() - start;
+    }
+    while (composer.dispose(set))
+        ;
+    Report(designation, "compose", size, static_cast<unsigned long>(size) * rounds, composing);
+    Report(designation, "accredit", size, static_cast<unsigned long>(size) * rounds, accrediting);
+    Report(designation, "discompose", size, static_cast<unsigned long>(size) * rounds, discomposing);
+}
+
+template <
+    typename Spatial,
+    typename Natural>
+static void
+MeasureAssociation(
+    Referential<Spatial>
+        map,
+    Referential<const Associative<Spatial, Natural, int, int>>
+        associator,
+    Referential<const Designative>
+        designation,
+    unsigned
+        size)
+{
+    const unsigned rounds = Rounds(size);
+    unsigned long long associating, corresponding, disassociating, start;
+    unsigned round, index;
+    associating = corresponding = disassociating = 0;
+    associator.disband(map);
+    for (round = 0; round < rounds; round++) {
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += associator.associate(map, Scramble(index, size), static_cast<int>(index));
+        associating += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += associator.correspond(map, Scramble(index + round, size));
+        corresponding += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += associator.disassociate(map, Scramble(index, size));
+        disassociating += Now() - start;
+    }
+    while (associator.dissolve(map))
+        ;
+    Report(designation, "associate", size, static_cast<unsigned long>(size) * rounds, associating);
+    Report(designation, "correspond", size, static_cast<unsigned long>(size) * rounds, corresponding);
+    Report(designation, "disassociate", size, static_cast<unsigned long>(size) * rounds, disassociating);
+}
+
+template <
+    typename Spatial,
+    typename Positional>
+static void
+MeasureTraction(
+    Referential<Spatial>
+        space,
+    Referential<const Tractile<Spatial, Positional, unsigned>>
+        tractor,
+    Referential<const Designative>
+        designation,
+    unsigned
+        size)
+{
+    const unsigned rounds = Rounds(size);
+    unsigned long long protracting, retracting, start;
+    unsigned round, index;
+    Positional position;
+    protracting = retracting = 0;
+    for (round = 0; round < rounds; round++) {
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += tractor.protract(space, position, 1);
+        protracting += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++)
+            Tally += tractor.retract(space, 1);
+        retracting += Now() - start;
+    }
+    Report(designation, "protract", size, static_cast<unsigned long>(size) * rounds, protracting);
+    Report(designation, "retract", size, static_cast<unsigned long>(size) * rounds, retracting);
+}
+
+template <
+    typename Spatial,
+    typename Positional,
+    unsigned Size>
+static void
+MeasureTribution(
+    Referential<Spatial>
+        pool,
+    Referential<const Tributary<Spatial, Positional, unsigned>>
+        contributor,
+    Referential<const Designative>
+        designation)
+{
+    static Positional positions[Size];
+    const unsigned rounds = Rounds(Size);
+    unsigned long long distributing, retributing, start;
+    unsigned round, index;
+    distributing = retributing = 0;
+    for (round = 0; round < rounds; round++) {
+        start = Now();
+        for (index = 0; index < Size; index++)
+            Tally += contributor.distribute(pool, positions[index]);
+        distributing += Now() - start;
+        start = Now();
+        for (index = 0; index < Size; index++)
+            Tally += contributor.retribute(pool, positions[Scramble(index, Size)]);
+        retributing += Now() - start;
+    }
+    Report(designation, "distribute", Size, static_cast<unsigned long>(Size) * rounds, distributing);
+    Report(designation, "retribute", Size, static_cast<unsigned long>(Size) * rounds, retributing);
+}
+
+template <
+    typename Spatial,
+    typename Positional>
+static void
+MeasureSearches(
+    Referential<const Spatial>
+        space,
+    Referential<const Lineal<const Spatial, Positional, unsigned, const int>>
+        liner,
+    Referential<const Designative>
+        designation,
+    unsigned
+        size)
+{
+    using namespace ::sortation;
+    const unsigned rounds = Rounds(size);
+    unsigned long long sectioning, iterating, bisecting, stepping, scaling, start;
+    unsigned round, index, extent, before, after;
+    Positional position;
+    int value;
+    sectioning = iterating = bisecting = stepping = scaling = 0;
+    for (round = 0; round < rounds; round++) {
+        start = Now();
+        for (index = 0; index < size; index++) {
+            value = Scramble(index + round, size);
+            liner.increment.begin(space, position, 0);
+            Tally += SearchSection(space, liner.increment, value, position, size - 1, IsEqual<int>);
+        }
+        sectioning += Now() - start;
+        start = Now();
+        liner.increment.begin(space, position, 0);
+        extent = size - 1;
+        for (index = 0; index < size; index++) {
+            value = static_cast<int>(index);
+            Tally += SearchSectionIteratively(space, liner.increment, value, position, extent, IsEqual<int>);
+        }
+        iterating += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++) {
+            value = Scramble(index + round, size);
+            liner.increment.begin(space, position, 0);
+            Tally += SearchBisection(space, liner, value, position, 0u, size - 1, IsEqual<int>, IsLesser<int>);
+        }
+        bisecting += Now() - start;
+        start = Now();
+        liner.increment.begin(space, position, 0);
+        before = 0;
+        after = size - 1;
+        for (index = 0; index < size; index++) {
+            value = static_cast<int>(index);
+            Tally += SearchBisectionIteratively(space, liner, value, position, before, after, IsEqual<int>, IsLesser<int>);
+        }
+        stepping += Now() - start;
+        start = Now();
+        for (index = 0; index < size; index++) {
+            value = Scramble(index + round, size);
+            liner.increment.begin(space, position, 0);
+            Tally += SearchScalarBisection(space, liner.increment, value, position, size - 1, IsEqual<int>, IsLesser<int>);
+        }
+        scaling += Now() - start;
+    }
+    Report(designation, "SearchSection", size, static_cast<unsigned long>(size) * rounds, sectioning);
+    Report(designation, "SearchSectionIteratively", size, static_cast<unsigned long>(size) * rounds, iterating);
+    Report(designation, "SearchBisection", size, static_cast<unsigned long>(size) * rounds, bisecting);
+    Report(designation, "SearchBisectionIteratively", size, static_cast<unsigned long>(size) * rounds, stepping);
+    Report(designation, "SearchScalarBisection", size, static_cast<unsigned long>(size) * rounds, scaling);
+}
+
+static void
+CountEvent(
+    const Locational<const void>
+        locality,
+    unsigned
+        identifier)
+{
+    Tally += identifier + (locality != 0);
+}
+
+template <unsigned Size>
+static void
+MeasureProcession()
+{
+    using namespace ::ration::contraction;
+    using EventSchedular = Contractional<unsigned, Size, Contextual<unsigned>>;
+    static constexpr auto& EventVisitor = WriteIncrementDirection<unsigned, Size, Contextual<unsigned>>;
+    static auto& ScheduleEvent = Schedule<EventSchedular, unsigned, unsigned, const unsigned, SureContractor<unsigned, Size, Contextual<unsigned>>, unsigned>;
+    static auto& ProcessEvent = ProcessOneEvent<EventSchedular, unsigned, unsigned, SureContractor<unsigned, Size, Contextual<unsigned>>, unsigned>;
+    static constexpr Designative Designation = { "procession", "contraction", "Sure" };
+    static EventSchedular schedule;
+    static const unsigned subject = 1;
+    const Locational<const unsigned> locality = &subject;
+    const unsigned rounds = Rounds(Size);
+    unsigned long long scheduling, processing, start;
+    unsigned round, index;
+    Initialize(schedule);
+    scheduling = processing = 0;
+    for (round = 0; round < rounds; round++) {
+        start = Now();
+        for (index = 0; index < Size; index++)
+            Tally += ScheduleEvent(EventVisitor, schedule, CountEvent, locality);
+        scheduling += Now() - start;
+        start = Now();
+        for (index = 0; index < Size; index++)
+            Tally += ProcessEvent(EventVisitor, schedule, index);
+        processing += Now() - start;
+    }
+    Report(Designation, "schedule", Size, static_cast<unsigned long>(Size) * rounds, scheduling);
+    Report(Designation, "process", Size, static_cast<unsigned long>(Size) * rounds, processing);
+}
+
+template <unsigned Size>
+static void
+MeasureRation()
+{
+    using namespace ::ration;
+    using namespace ::ration::consecution;
+    using namespace ::ration::selection;
+    using namespace ::ration::collection;
+    using namespace ::ration::association;
+    using namespace ::ration::association::selection;
+    using namespace ::ration::association::collection;
+    using namespace ::ration::elevation;
+    using namespace ::ration::contraction;
+    using namespace ::ration::contribution;
+    using ListResourceful = Resourceful<unsigned, Size, int>;
+    using MapResourceful = AssociativelyResourceful<unsigned, Size, int, int>;
+    static constexpr Designative FastSelection = { "selection", "ration", "Fast" };
+    static constexpr Designative SureSelection = { "selection", "ration", "Sure" };
+    static constexpr Designative FastCollection = { "collection", "ration", "Fast" };
+    static constexpr Designative SureCollection = { "collection", "ration", "Sure" };
+    static constexpr Designative FastCorrelation = { "association/selection", "ration", "Fast" };
+    static constexpr Designative SureCorrelation = { "association/selection", "ration", "Sure" };
+    static constexpr Designative FastAssociation = { "association/collection", "ration", "Fast" };
+    static constexpr Designative SureAssociation = { "association/collection", "ration", "Sure" };
+    static constexpr Designative FastElevation = { "elevation", "ration", "Fast" };
+    static constexpr Designative SureElevation = { "elevation", "ration", "Sure" };
+    static constexpr Designative FastContraction = { "contraction", "ration", "Fast" };
+    static constexpr Designative SureContraction = { "contraction", "ration", "Sure" };
+    static constexpr Designative FastContribution = { "contribution", "ration", "Fast" };
+    static constexpr Designative SureContribution = { "contribution", "ration", "Sure" };
+    static constexpr Designative Sortation = { "sortation", "ration", "ReadLiner" };
+    static ListResourceful set;
+    static MapResourceful map;
+    static Elevatory<unsigned, Size, int> stack;
+    static Contractional<unsigned, Size, int> queue;
+    static Contributory<unsigned, Size, int> pool;
+    unsigned index;
+    ::ration::consecution::Initialize(set);
+    ::ration::consecution::Initialize(map);
+    ::ration::elevation::Initialize(stack);
+    ::ration::contraction::Initialize(queue);
+    ::ration::contribution::Initialize(pool);
+    MeasureComposition(set, FastSelector<unsigned, Size, int, IsEqual<int>, MoveElements<unsigned, int>>.composer, FastSelection, Size);
+    MeasureComposition(set, SureSelector<unsigned, Size, int, IsEqual<int>, MoveElements<unsigned, int>>.composer, SureSelection, Size);
+    MeasureComposition(set, FastOrderedComposer<unsigned, Size, int, IsEqual<int>, IsLesser<int>, MoveElements<unsigned, int>>, FastCollection, Size);
+    MeasureComposition(set, SureOrderedComposer<unsigned, Size, int, IsEqual<int>, IsLesser<int>, MoveElements<unsigned, int>>, SureCollection, Size);
+    MeasureAssociation(map, FastCorrelator<unsigned, Size, int, int, IsEqual<int>, MoveElements<unsigned, MapComplementary>>, FastCorrelation, Size);
+    MeasureAssociation(map, SureCorrelator<unsigned, Size, int, int, IsEqual<int>, MoveElements<unsigned, MapComplementary>>, SureCorrelation, Size);
+    MeasureAssociation(map, FastAssociator<unsigned, Size, int, int, IsEqual<int>, IsLesser<int>, MoveElements<unsigned, MapComplementary>>, FastAssociation, Size);
+    MeasureAssociation(map, SureAssociator<unsigned, Size, int, int, IsEqual<int>, IsLesser<int>, MoveElements<unsigned, MapComplementary>>, SureAssociation, Size);
+    MeasureTraction(stack, FastElevator<unsigned, Size, int>, FastElevation, Size);
+    MeasureTraction(stack, SureElevator<unsigned, Size, int>, SureElevation, Size);
+    MeasureTraction(queue, FastContractor<unsigned, Size, int>, FastContraction, Size);
+    MeasureTraction(queue, SureContractor<unsigned, Size, int>, SureContraction, Size);
+    MeasureTribution<Contributory<unsigned, Size, int>, unsigned, Size>(pool, FastContributor<unsigned, Size, int>, FastContribution);
+    MeasureTribution<Contributory<unsigned, Size, int>, unsigned, Size>(pool, SureContributor<unsigned, Size, int>, SureContribution);
+    ::ration::consecution::Initialize(set);
+    for (index = 0; index < Size; index++)
+        Proceed<unsigned, Size, int, false>(set, static_cast<int>(index));
+    MeasureSearches(set, ::ration::consecution::ReadLiner<unsigned, Size, int>, Sortation, Size);
+}
+
+template <unsigned Size>
+static void
+MeasureJunction()
+{
+    using namespace ::junction;
+    using namespace ::junction::consecution;
+    using namespace ::junction::selection;
+    using namespace ::junction::collection;
+    using namespace ::junction::association::selection;
+    using namespace ::junction::association::collection;
+    using namespace ::junction::provision::elevation;
+    using namespace ::junction::provision::contraction;
+    using namespace ::junction::provision::contribution;
+    using ListJunctive = DoublyJunctive<unsigned, int>;
+    using MapJunctive = ::junction::association::AssociativelyDoubleJunctive<unsigned, int, int>;
+    static constexpr Designative FastSelection = { "selection", "junction", "Fast" };
+    static constexpr Designative SafeSelection = { "selection", "junction", "Safe" };
+    static constexpr Designative FastCollection = { "collection", "junction", "Fast" };
+    static constexpr Designative SafeCollection = { "collection", "junction", "Safe" };
+    static constexpr Designative FastCorrelation = { "association/selection", "junction", "Fast" };
+    static constexpr Designative SafeCorrelation = { "association/selection", "junction", "Safe" };
+    static constexpr Designative FastAssociation = { "association/collection", "junction", "Fast" };
+    static constexpr Designative SafeAssociation = { "association/collection", "junction", "Safe" };
+    static constexpr Designative FastElevation = { "elevation", "junction", "Fast" };
+    static constexpr Designative SafeElevation = { "elevation", "junction", "Safe" };
+    static constexpr Designative FastContraction = { "contraction", "junction", "Fast" };
+    static constexpr Designative SafeContraction = { "contraction", "junction", "Safe" };
+    static constexpr Designative FastContribution = { "contribution", "junction", "Fast" };
+    static constexpr Designative SafeContribution = { "contribution", "junction", "Safe" };
+    static constexpr Designative Sortation = { "sortation", "junction", "ReadDoubleLiner" };
+    static auto& ListSequencer = DoubleSequencer<unsigned, int, ListAdjunct>;
+    static DoublyNodal<int> nodes[Size];
+    ListJunctive set, list;
+    MapJunctive map;
+    unsigned index;
+    Initialize(set);
+    Initialize(list);
+    Initialize(map);
+    MeasureComposition(set, DoubleSelector<unsigned, int, IsEqual<int>, ListAdjunct>.composer, FastSelection, Size);
+    MeasureComposition(set, SafeDoubleSelector<unsigned, int, IsEqual<int>, ListAdjunct>.composer, SafeSelection, Size);
+    MeasureComposition(set, OrderedDoubleComposer<unsigned, int, IsEqual<int>, IsLesser<int>, ListAdjunct>, FastCollection, Size);
+    MeasureComposition(set, SafeOrderedDoubleComposer<unsigned, int, IsEqual<int>, IsLesser<int>, ListAdjunct>, SafeCollection, Size);
+    MeasureAssociation(map, DoubleCorrelator<unsigned, int, int, IsEqual<int>, MapAdjunct>, FastCorrelation, Size);
+    MeasureAssociation(map, SafeDoubleCorrelator<unsigned, int, int, IsEqual<int>, MapAdjunct>, SafeCorrelation, Size);
+    MeasureAssociation(map, DoubleAssociator<unsigned, int, int, IsEqual<int>, IsLesser<int>, MapAdjunct>, FastAssociation, Size);
+    MeasureAssociation(map, SafeDoubleAssociator<unsigned, int, int, IsEqual<int>, IsLesser<int>, MapAdjunct>, SafeAssociation, Size);
+    IntegrateNodes(list, nodes);
+    MeasureTraction(list, DoubleElevator<unsigned, int>, FastElevation, Size);
+    MeasureTraction(list, SafeDoubleElevator<unsigned, int>, SafeElevation, Size);
+    MeasureTraction(list, DoubleContractor<unsigned, int>, FastContraction, Size);
+    MeasureTraction(list, SafeDoubleContractor<unsigned, int>, SafeContraction, Size);
+    MeasureTribution<ListJunctive, DoublyPositional<int>, Size>(list, DoubleContributor<unsigned, int>, FastContribution);
+    MeasureTribution<ListJunctive, DoublyPositional<int>, Size>(list, SafeDoubleContributor<unsigned, int>, SafeContribution);
+    for (index = 0; index < Size; index++)
+        ListSequencer.proceed(set, static_cast<int>(index));
+    MeasureSearches(set, ReadDoubleLiner<unsigned, int>, Sortation, Size);
+    ListSequencer.secede(set);
+    while (ListSequencer.condense(set))
+        ;
+}
+
+template <unsigned Size>
+static void
+MeasureSize()
+{
+    MeasureRation<Size>();
+    MeasureJunction<Size>();
+    MeasureProcession<Size>();
+}
+
+int main(
+    int
+        argc,
+    Locational<Locational<char>>
+        argv)
+{
+    enum Erroneous {
+        NumberOfArguments = -1
+    };
+    if (argc > 2 || (argc == 2 && strcmp(argv[1], "csv") && strcmp(argv[1], "json"))) {
+        fprintf(stderr, "%s ?csv|json?\n", argv[0]);
+        return Erroneous::NumberOfArguments;
+    }
+    Notated = argc == 2 && !strcmp(argv[1], "json");
+    MeasureSize<0x10>();
+    MeasureSize<0x40>();
+    MeasureSize<0x100>();
+    if (Notated)
+        puts(Reported ? "\n]" : "[]");
+}
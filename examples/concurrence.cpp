@@ -0,0 +1,64 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+// #define RAPBTL_NO_STD_CPLUSPLUS
+#include <sortation/concurrent.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstdio>
+#else
+extern "C" {
+#include <stdio.h>
+}
+#endif
+
+using namespace ::comparison;
+using namespace ::sortation;
+constexpr unsigned Threads = 4;
+constexpr unsigned Larger = 100000, Smaller = 500, Shared = 100;
+
+static int base[Larger], relative[Larger], target[Larger + Smaller];
+
+static inline bool
+Compose(
+    const unsigned
+        base_count,
+    const unsigned
+        relative_count,
+    const unsigned
+        united,
+    const unsigned
+        intersected)
+{
+    static auto& Unite = UniteSegmentsConcurrently<unsigned, int, Threads, IsEqual<int>, IsLesser<int>>;
+    static auto& Intersect = IntersectSegmentsConcurrently<unsigned, int, Threads, IsEqual<int>, IsLesser<int>>;
+    unsigned index, count;
+    count = Unite(base, base_count, relative, relative_count, target);
+    printf("union of %u and %u elements: %u\n", base_count, relative_count, count);
+    if (count != united)
+        return false;
+    for (index = 1; index < count; index++)
+        if (target[index - 1] >= target[index])
+            return false;
+    count = Intersect(base, base_count, relative, relative_count, target);
+    printf("intersection of %u and %u elements: %u\n", base_count, relative_count, count);
+    return count == intersected;
+}
+
+int main()
+{
+    unsigned index;
+    // The smaller relative segment begins before the base segment
+    for (index = 0; index < Larger; index++)
+        base[index] = Smaller - Shared + index;
+    for (index = 0; index < Smaller; index++)
+        relative[index] = index;
+    if (!Compose(Larger, Smaller, Larger + Smaller - Shared, Shared))
+        return -1;
+    // The smaller base segment begins before the relative segment
+    for (index = 0; index < Smaller; index++)
+        base[index] = index;
+    for (index = 0; index < Larger; index++)
+        relative[index] = Smaller - Shared + index;
+    if (!Compose(Smaller, Larger, Larger + Smaller - Shared, Shared))
+        return -1;
+    return 0;
+}
@@ -2,6 +2,9 @@
 // Licensed under the Academic Free License version 3.0
 // #define RAPBTL_NO_STD_CPLUSPLUS
 #include <ration/collection.hpp>
+#include <sortation/external.hpp>
+#include <transcription/mapping.hpp>
+#include <transcription/stdio.hpp>
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
 #include <cstdio>
 #else
@@ -11,33 +14,6 @@ extern "C" {
 #endif
 
 using namespace ::location;
-using namespace ::trajection;
-
-template <
-    typename Spatial,
-    typename Positional,
-    typename Natural>
-static inline bool
-OutputIntegers(
-    Referential<const Spatial>
-        list,
-    Referential<const Directional<const Spatial, Positional, Natural, const int>>
-        direction,
-    Locational<FILE>
-        handle)
-{
-    Positional position;
-    if (!direction.begins(list, 0))
-        return false;
-    direction.scale.begin(list, position, 0);
-    while (true) {
-        fprintf(handle, "%d\n", direction.scale.go(list, position).to);
-        if (!direction.traverses(list, position, 1))
-            break;
-        direction.scale.traverse(list, position, 1);
-    }
-    return true;
-}
 
 int main(
     int
@@ -49,20 +25,34 @@ int main(
     using namespace ::ration::collection;
     using namespace ::ration::consecution;
     using namespace ::comparison;
+    using namespace ::sortation::external;
+    using namespace ::transcription;
+    using namespace ::transcription::mapping;
+    using namespace ::transcription::stdio;
     enum Erroneous {
         NumberOfArguments = -1,
         InputFile = -2,
         OutputFile = -3,
-        IntegerCount = -4
+        TemporaryFile = -4
     };
     static constexpr unsigned CacheLimit = 0x2000, CacheReserve = 0x80;
     static constexpr unsigned MaximumNodes = (CacheLimit - CacheReserve) / sizeof(int);
+    static constexpr unsigned MaximumRuns = 0x10, RunBuffer = CacheLimit / sizeof(int);
+    static constexpr unsigned OutputBuffer = 0x10000;
     using IntegerResourceful = Resourceful<unsigned, MaximumNodes, int>;
-    static auto& Composer = SureOrderedComposer<unsigned, MaximumNodes, int, IsEqual<int>, IsLesser<int>, MoveElements<unsigned, int>>;
+    using IntegerExternalized = Externalized<unsigned, int, MaximumRuns, RunBuffer>;
+    static auto& Append = Proceed<unsigned, MaximumNodes, int, false>;
+    static auto& Constitute = ConstituteCollection<unsigned, MaximumNodes, int, IsEqual<int>, IsLesser<int>, true>;
     static auto& Increment = ReadIncrementDirection<unsigned, MaximumNodes, int>;
-    Locational<FILE> input, output;
+    Locational<FILE> output;
+    Mapped input;
+    static IntegerExternalized runs;
+    static Transcriptive<unsigned, OutputBuffer> writer;
+    static int scratch[MaximumNodes];
     IntegerResourceful set;
-    int value;
+    unsigned duplicates;
+    int last;
+    bool held, failed, unwritten;
     output = stdout;
     switch (argc) {
     case 3:
@@ -72,9 +62,10 @@ int main(
             return Erroneous::OutputFile;
         }
     case 2:
-        input = fopen(argv[1], "r");
-        if (!input) {
+        if (!Map(input, argv[1])) {
             fprintf(stderr, "Could not read from file '%s'\n", argv[1]);
+            if (output != stdout)
+                fclose(output);
             return Erroneous::InputFile;
         }
         break;
@@ -83,21 +74,63 @@ int main(
         return Erroneous::NumberOfArguments;
     }
     Initialize(set);
-    while (!feof(input)) {
-        if (fscanf(input, "%d", Locate(value).at) == 1) {
-            if (Account(set) == MaximumNodes) {
-                fprintf(stderr, "Maximum number of integers is %u\n", MaximumNodes);
-                if (output != stdout)
-                    fclose(output);
-                fclose(input);
-                return Erroneous::IntegerCount;
+    Initialize(runs);
+    Initialize(writer, output);
+    duplicates = 0;
+    auto constitute = [&set, &duplicates]() {
+        const unsigned count = Account(set);
+        Constitute(set, scratch);
+        duplicates += count - Account(set);
+    };
+    auto spill = [&set, &constitute]() -> bool {
+        constitute();
+        if (!Spill<false>(runs, set.source, Account(set), IsEqual<int>, IsLesser<int>))
+            return false;
+        Initialize(set);
+        return true;
+    };
+    failed = false;
+    auto compose = [&set, &failed, &spill](Referential<const int> value) -> bool {
+        if (Account(set) == MaximumNodes && !spill()) {
+            failed = true;
+            return false;
+        }
+        return Append(set, value);
+    };
+    ParseIntegers<size_t, int>(input.text, input.length, compose);
+    Unmap(input);
+    unwritten = false;
+    if (runs.count == 0 && !failed) {
+        constitute();
+        unwritten = !TranscribeIntegers(writer, set, Increment, '\n');
+    } else {
+        held = false;
+        auto emit = [&held, &last, &duplicates, &unwritten](Referential<const int> value) -> bool {
+            if (held && value == last) {
+                duplicates++;
+                return true;
             }
-            if (!Composer.compose(set, value))
-                fprintf(stderr, "Duplicate integer %d ignored\n", value);
+            held = true;
+            last = value;
+            unwritten = !Transcribe(writer, value, '\n');
+            return !unwritten;
+        };
+        if (failed || !spill() || (!Merge<false>(runs, emit, IsEqual<int>, IsLesser<int>) && !unwritten)) {
+            fprintf(stderr, "Could not use temporary file\n");
+            Discard(runs);
+            if (output != stdout)
+                fclose(output);
+            return Erroneous::TemporaryFile;
         }
     }
-    OutputIntegers(set, Increment, output);
+    if (unwritten || !Flush(writer)) {
+        fprintf(stderr, "Could not write to file '%s'\n", argc == 3 ? argv[2] : "stdout");
+        if (output != stdout)
+            fclose(output);
+        return Erroneous::OutputFile;
+    }
+    if (duplicates > 0)
+        fprintf(stderr, "%u duplicate integers ignored\n", duplicates);
     if (output != stdout)
         fclose(output);
-    fclose(input);
 }
@@ -234,7 +234,7 @@ namespace alignment {
         typename Subjective,
         size_t Alignment = alignof(Subjective),
         size_t Size = sizeof(Subjective)>
-    constexpr ArrayAllocative<Subjective, size_t>
+    constexpr ArrayAllocative<size_t, Subjective>
         ArrayAligned = {
             AllocateAlignedArray<Subjective, Alignment, Size>,
             DeleteAlignedSubjectAndSetToNull<Subjective>
@@ -258,7 +258,7 @@ namespace alignment {
         typename Subjective,
         size_t Alignment = alignof(Subjective),
         size_t Size = sizeof(Subjective)>
-    constexpr ArrayAllocative<Subjective, size_t>
+    constexpr ArrayAllocative<size_t, Subjective>
         FastArrayAligned = {
             AllocateAlignedArray<Subjective, Alignment, Size>,
             DeleteAlignedSubject<Subjective>
@@ -0,0 +1,448 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef ALLOCATION_PAGING_MODULE
+#define ALLOCATION_PAGING_MODULE
+#include <allocation.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstdint>
+#else
+extern "C" {
+#include <stdint.h>
+}
+#endif
+// Requires mmap From POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+// Requires mbind From Linux
+#include <sys/syscall.h>
+#endif
+
+namespace allocation {
+
+/**
+ * @brief
+ *     Page mapped memory allocation implementations using the POSIX mmap
+ *     function with Linux huge page and NUMA placement extensions.
+ * @details
+ *     Page mapped memory allocation functions and objectives are provided
+ *     in order to allocate large memory spaces, such as contributory pools
+ *     and big ration arrays, directly from the operating system.  Spaces of
+ *     at least one huge page are aligned to a huge page boundary and
+ *     advised to be backed by transparent huge pages, or if the kernel
+ *     does not support transparent huge pages, mapped from the hugetlbfs
+ *     reserve, and otherwise mapped with ordinary pages.  When a NUMA node
+ *     is specified, the pages are bound to that node using the Linux mbind
+ *     system call.  Where the node cannot be bound, pages are placed by the
+ *     operating system on first touch, so spaces should then be claimed
+ *     and first written by a thread running on the intended node.  The
+ *     size of each mapping is recorded in a prefix before the space, so
+ *     each space is rounded up to a whole number of pages.  Since the
+ *     prefix is written as soon as the pages are mapped, an unbound space
+ *     has its first page, which is a whole huge page for large spaces,
+ *     placed on the node of the thread which allocated it.
+ */
+namespace paging {
+
+    /**
+     * @brief
+     *     Unbound NUMA node.
+     * @details
+     *     Node value used to leave page placement to the operating system.
+     */
+    constexpr int AnyNode = -1;
+
+    /**
+     * @brief
+     *     Huge page size.
+     * @details
+     *     Size of the transparent huge pages and default hugetlbfs pages
+     *     of x86-64 and AArch64 Linux kernels.
+     */
+    constexpr size_t HugePage = 1 << 21;
+
+    /**
+     * @brief
+     *     Number of NUMA nodes which can be bound.
+     */
+    constexpr int NodeLimit = 1024;
+
+    /**
+     * @brief
+     *     Linux MPOL_BIND memory policy mode.
+     */
+    constexpr int BindPolicy = 2;
+
+    /**
+     * @brief
+     *     Size of the prefix recording the mapping size.
+     * @details
+     *     The prefix occupies at least one 64 byte cache line, so that the
+     *     space begins on a cache line boundary, or the alignment of the
+     *     allocated space if it is greater.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should align to.
+     */
+    template <size_t Alignment>
+    constexpr size_t Prefix = Alignment > 64 ? Alignment : 64;
+
+    /**
+     * @brief
+     *     Binds the pages of a mapping to a NUMA node.
+     * @details
+     *     If the node is AnyNode, exceeds the node limit or the system call
+     *     is not available or fails, the pages are left to be placed on
+     *     first touch.
+     * @param[in] base
+     *     Address of the mapping.
+     * @param[in] extent
+     *     Size of the mapping in bytes.
+     * @param[in] node
+     *     NUMA node to bind the pages to.
+     * @return
+     *     True if the pages were bound to the node.
+     */
+    static inline bool
+    BindPages(
+        Locational<void>
+            base,
+        const size_t
+            extent,
+        const int
+            node)
+    {
+#if defined(__linux__) && defined(SYS_mbind)
+        constexpr size_t Bits = sizeof(unsigned long) * 8;
+        if (node < 0 || node >= NodeLimit)
+            return false;
+        unsigned long mask[NodeLimit / Bits] = {};
+        mask[node / Bits] = 1UL << (node % Bits);
+        return syscall(SYS_mbind, base, extent, BindPolicy, mask, NodeLimit + 1, 0) == 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief
+     *     Maps a memory space.
+     * @details
+     *     Spaces of at least one huge page are mapped at a huge page
+     *     boundary and advised to be backed by transparent huge pages,
+     *     falling back to the hugetlbfs reserve and then to ordinary pages.
+     *     The size of the mapping is stored at its start.
+     * @param[in] length
+     *     Number of bytes required.
+     * @param[in] node
+     *     NUMA node to bind the pages to.
+     * @return
+     *     Address of the mapping, or null if no memory could be mapped.
+     */
+    static inline Locational<unsigned char>
+    MapPages(
+        const size_t
+            length,
+        const int
+            node)
+    {
+        constexpr int Protection = PROT_READ | PROT_WRITE;
+        constexpr int Anonymous = MAP_PRIVATE | MAP_ANONYMOUS;
+        Locational<void> base = MAP_FAILED;
+        size_t extent = length;
+#if defined(MADV_HUGEPAGE) || defined(MAP_HUGETLB)
+        if (length >= HugePage) {
+            extent = (length + HugePage - 1) / HugePage * HugePage;
+#ifdef MADV_HUGEPAGE
+            const Locational<void> region = mmap(nullptr, extent + HugePage, Protection, Anonymous, -1, 0);
+            if (region != MAP_FAILED) {
+                const size_t start = reinterpret_cast<size_t>(region);
+                const size_t head = (HugePage - start % HugePage) % HugePage;
+                base = static_cast<Locational<unsigned char>>(region) + head;
+                if (head > 0)
+                    munmap(region, head);
+                munmap(static_cast<Locational<unsigned char>>(base) + extent, HugePage - head);
+                if (madvise(base, extent, MADV_HUGEPAGE) != 0) {
+                    munmap(base, extent);
+                    base = MAP_FAILED;
+                }
+            }
+#endif
+#ifdef MAP_HUGETLB
+            if (base == MAP_FAILED)
+                base = mmap(nullptr, extent, Protection, Anonymous | MAP_HUGETLB, -1, 0);
+#endif
+            if (base == MAP_FAILED)
+                extent = length;
+        }
+#endif
+        if (base == MAP_FAILED)
+            base = mmap(nullptr, extent, Protection, Anonymous, -1, 0);
+        if (base == MAP_FAILED)
+            return nullptr;
+        BindPages(base, extent, node);
+        *static_cast<Locational<size_t>>(base) = extent;
+        return static_cast<Locational<unsigned char>>(base);
+    }
+
+    /**
+     * @brief
+     *     Allocates page mapped memory space for an instance of the
+     *     specified type.
+     * @details
+     *     With this function, memory is mapped from the operating system
+     *     and no constructor is invoked.
+     * @tparam Subjective
+     *     Type of the data object.
+     * @tparam Node
+     *     NUMA node to bind the pages to, or AnyNode.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should be aligned to.
+     * @tparam Size
+     *     Size of the memory space to be allocated.
+     * @param[out] locality
+     *     Reference to a pointer which will receive the address of the
+     *     allocated data object, or null if no memory could be mapped.
+     * @return
+     *     The same address as stored in the pointer which was bound to
+     *     locality.
+     */
+    template <
+        typename Subjective,
+        int Node = AnyNode,
+        size_t Alignment = alignof(Subjective),
+        size_t Size = sizeof(Subjective)>
+    static inline const Locational<Subjective>
+    AllocatePagedElement(
+        Referential<Locational<Subjective>>
+            locality)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        static_assert(
+            Alignment > 0 && (Alignment & (Alignment - 1)) == 0 && Alignment <= 4096,
+            "Alignment:  Power of two no greater than a page required");
+#endif
+        const Locational<unsigned char> base = MapPages(Prefix<Alignment> + Size, Node);
+        return locality = base ? reinterpret_cast<Locational<Subjective>>(base + Prefix<Alignment>) : nullptr;
+    }
+
+    /**
+     * @brief
+     *     Allocates page mapped memory space for an array of instances of
+     *     the specified type.
+     * @details
+     *     With this function, memory is mapped from the operating system
+     *     and no constructor is invoked.
+     * @tparam Subjective
+     *     Type of the data object to be allocated.
+     * @tparam Node
+     *     NUMA node to bind the pages to, or AnyNode.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should align to.
+     * @tparam Size
+     *     Size of the memory space to be allocated.
+     * @param[out] locality
+     *     Reference to a pointer which will receive the address of the
+     *     allocated array of data objects, or null if no memory could be
+     *     mapped.
+     * @param[in] count
+     *     The number of objects to be allocated.  If the size of the
+     *     array and its prefix would exceed the range of size_t, no memory
+     *     is mapped and null is returned.
+     * @return
+     *     The same address as stored in the pointer which was bound to
+     *     locality.
+     */
+    template <
+        typename Subjective,
+        int Node = AnyNode,
+        size_t Alignment = alignof(Subjective),
+        size_t Size = sizeof(Subjective)>
+    static inline const Locational<Subjective>
+    AllocatePagedArray(
+        Referential<Locational<Subjective>>
+            locality,
+        Referential<const size_t>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        static_assert(
+            Alignment > 0 && (Alignment & (Alignment - 1)) == 0 && Alignment <= 4096,
+            "Alignment:  Power of two no greater than a page required");
+#endif
+        if (count > (SIZE_MAX - Prefix<Alignment>) / Size)
+            return locality = nullptr;
+        const Locational<unsigned char> base = MapPages(Prefix<Alignment> + count * Size, Node);
+        return locality = base ? reinterpret_cast<Locational<Subjective>>(base + Prefix<Alignment>) : nullptr;
+    }
+
+    /**
+     * @brief
+     *     Frees the page mapped memory space for an instance of the
+     *     specified type.
+     * @details
+     *     With this function, the mapping is returned to the operating
+     *     system, no destructor is invoked and the pointer will not be set
+     *     to null.  The alignment must match the one used to allocate.
+     * @tparam Subjective
+     *     Type of the data object.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory was aligned to.
+     * @param[in] locality
+     *     Reference to a pointer containing the address which will be
+     *     freed.
+     * @return
+     *     Does not return any value.
+     */
+    template <
+        typename Subjective,
+        size_t Alignment = alignof(Subjective)>
+    static inline void
+    DeletePagedSubject(Referential<Locational<Subjective>> locality)
+    {
+        if (!locality)
+            return;
+        const Locational<unsigned char> base = reinterpret_cast<Locational<unsigned char>>(locality) - Prefix<Alignment>;
+        munmap(base, *reinterpret_cast<Locational<size_t>>(base));
+    }
+
+    /**
+     * @brief
+     *     Frees the page mapped memory space for an instance of the
+     *     specified type.
+     * @details
+     *     With this function, the mapping is returned to the operating
+     *     system, no destructor is invoked and the pointer is set to null.
+     *     The alignment must match the one used to allocate.
+     * @tparam Subjective
+     *     Type of the data object.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory was aligned to.
+     * @param[in,out] locality
+     *     Reference to a pointer containing the address which will be
+     *     freed.
+     * @return
+     *     Does not return any value.
+     */
+    template <
+        typename Subjective,
+        size_t Alignment = alignof(Subjective)>
+    static inline void
+    DeletePagedSubjectAndSetToNull(Referential<Locational<Subjective>> locality)
+    {
+        DeletePagedSubject<Subjective, Alignment>(locality);
+        SetToNull(locality);
+    }
+
+    /**
+     * @brief
+     *     Default page mapped memory allocation.
+     * @details
+     *     Objective table which uses page mapped allocate and free
+     *     functions.  Disclaim frees the mapping and then sets the pointer
+     *     to null.
+     * @tparam Subjective
+     *     Type of the data objects.
+     * @tparam Node
+     *     NUMA node to bind the pages to, or AnyNode.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should align to.
+     * @tparam Size
+     *     Size of the memory space to be allocated.
+     */
+    template <
+        typename Subjective,
+        int Node = AnyNode,
+        size_t Alignment = alignof(Subjective),
+        size_t Size = sizeof(Subjective)>
+    constexpr DefaultAllocative<Subjective>
+        DefaultPaged = {
+            AllocatePagedElement<Subjective, Node, Alignment, Size>,
+            DeletePagedSubjectAndSetToNull<Subjective, Alignment>
+        };
+
+    /**
+     * @brief
+     *     Default page mapped memory allocation.
+     * @details
+     *     Objective table which uses page mapped allocate and free
+     *     functions.  Disclaim frees the mapping but does not set the
+     *     pointer to null.
+     * @tparam Subjective
+     *     Type of the data objects.
+     * @tparam Node
+     *     NUMA node to bind the pages to, or AnyNode.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should align to.
+     * @tparam Size
+     *     Size of the memory space to be allocated.
+     */
+    template <
+        typename Subjective,
+        int Node = AnyNode,
+        size_t Alignment = alignof(Subjective),
+        size_t Size = sizeof(Subjective)>
+    constexpr DefaultAllocative<Subjective>
+        FastDefaultPaged = {
+            AllocatePagedElement<Subjective, Node, Alignment, Size>,
+            DeletePagedSubject<Subjective, Alignment>
+        };
+
+    /**
+     * @brief
+     *     Array page mapped memory allocation.
+     * @details
+     *     Objective table which allocates uninitialized page mapped memory
+     *     for an array.  Disclaim frees the mapping and then sets the
+     *     pointer to null.
+     * @tparam Subjective
+     *     Type of the data objects.
+     * @tparam Node
+     *     NUMA node to bind the pages to, or AnyNode.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should align to.
+     * @tparam Size
+     *     Size of the memory space to be allocated.
+     */
+    template <
+        typename Subjective,
+        int Node = AnyNode,
+        size_t Alignment = alignof(Subjective),
+        size_t Size = sizeof(Subjective)>
+    constexpr ArrayAllocative<size_t, Subjective>
+        ArrayPaged = {
+            AllocatePagedArray<Subjective, Node, Alignment, Size>,
+            DeletePagedSubjectAndSetToNull<Subjective, Alignment>
+        };
+
+    /**
+     * @brief
+     *     Array page mapped memory allocation.
+     * @details
+     *     Objective table which allocates uninitialized page mapped memory
+     *     for an array.  Disclaim frees the mapping but does not set the
+     *     pointer to null.
+     * @tparam Subjective
+     *     Type of the data objects.
+     * @tparam Node
+     *     NUMA node to bind the pages to, or AnyNode.
+     * @tparam Alignment
+     *     Byte boundary the allocated memory should align to.
+     * @tparam Size
+     *     Size of the memory space to be allocated.
+     */
+    template <
+        typename Subjective,
+        int Node = AnyNode,
+        size_t Alignment = alignof(Subjective),
+        size_t Size = sizeof(Subjective)>
+    constexpr ArrayAllocative<size_t, Subjective>
+        FastArrayPaged = {
+            AllocatePagedArray<Subjective, Node, Alignment, Size>,
+            DeletePagedSubject<Subjective, Alignment>
+        };
+
+}
+
+}
+
+#endif
@@ -214,7 +214,7 @@ namespace stdlib {
      *     Type of the data objects.
      */
     template <typename Subjective>
-    constexpr ArrayAllocative<Subjective, size_t>
+    constexpr ArrayAllocative<size_t, Subjective>
         ArrayMalloc = {
             AllocateArrayUsingMalloc<Subjective>,
             DeleteUsingFreeAndSetToNull<Subjective>
@@ -230,7 +230,7 @@ namespace stdlib {
      *     Type of the data objects.
      */
     template <typename Subjective>
-    constexpr ArrayAllocative<Subjective, size_t>
+    constexpr ArrayAllocative<size_t, Subjective>
         FastArrayMalloc = {
             AllocateArrayUsingMalloc<Subjective>,
             DeleteUsingFree<Subjective>
@@ -278,7 +278,7 @@ namespace stdlib {
      *     Type of the data objects.
      */
     template <typename Subjective>
-    constexpr ArrayAllocative<Subjective, size_t>
+    constexpr ArrayAllocative<size_t, Subjective>
         ArrayCalloc = {
             AllocateArrayUsingCalloc<Subjective>,
             DeleteUsingFreeAndSetToNull<Subjective>
@@ -294,7 +294,7 @@ namespace stdlib {
      *     Type of the data objects.
      */
     template <typename Subjective>
-    constexpr ArrayAllocative<Subjective, size_t>
+    constexpr ArrayAllocative<size_t, Subjective>
         FastArrayCalloc = {
             AllocateArrayUsingCalloc<Subjective>,
             DeleteUsingFree<Subjective>
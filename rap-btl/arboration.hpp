@@ -0,0 +1,1582 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef ARBORATION_MODULE
+#define ARBORATION_MODULE
+#include <allocation.hpp>
+#include <sortation.hpp>
+#include <trajection.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+/**
+ * @brief
+ *     Chunked B+ tree management and trajection implementation.
+ * @details
+ *     Ordered tree management and trajection implementation where every
+ *     node holds an array of up to a fixed breadth of elements.  Elements
+ *     are only stored in the leaves, which are linked in order so that
+ *     scales traverse contiguous arrays instead of chasing one pointer per
+ *     element.  Branches hold the least element of each child subtree
+ *     beside the link to that child, which is used to route searches.  The
+ *     breadth should be chosen so that a node fills a whole number of
+ *     cache lines or a memory page, for which the Fanout constant is
+ *     provided.  Nodes are claimed and disclaimed one at a time through a
+ *     default allocation objective.  Positions are invalidated whenever the
+ *     tree is modified.
+ */
+namespace arboration {
+
+using ::allocation::DefaultAllocative;
+using ::comparison::Comparative;
+using ::comparison::Equative;
+using ::comparison::Relational;
+using ::location::Conferential;
+using ::location::Locational;
+using ::location::Referential;
+using ::sortation::Assortive;
+using ::trajection::Axial;
+using ::trajection::Directional;
+using ::trajection::Lineal;
+using ::trajection::Scalar;
+using ::trajection::Vectorial;
+
+/**
+ * @brief
+ *     Tree node conformity.
+ * @details
+ *     This type is used to represent both the leaves and the branches of a
+ *     tree.  A leaf uses the first two links for the previous and next
+ *     leaves in order.  A branch uses one link per child along with the
+ *     least element of the child subtree.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Breadth
+ *     The maximum number of elements or children in a node.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+struct Ramal {
+
+    Natural
+        count; /**< Number of elements or children in the node. */
+
+    Elemental
+        elements[Breadth]; /**< Elements of a leaf or least elements of the
+                            *   children of a branch.
+                            */
+
+    Locational<Ramal<Natural, Breadth, Elemental>>
+        links[Breadth]; /**< Leaf chain links or branch child links. */
+};
+
+/**
+ * @brief
+ *     Tree conformity.
+ * @details
+ *     This type is used to represent a tree.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Breadth
+ *     The maximum number of elements or children in a node.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+struct Arboreal {
+
+    Locational<Ramal<Natural, Breadth, Elemental>>
+        root, /**< Root node of the tree. */
+        first, /**< First leaf in order. */
+        last; /**< Last leaf in order. */
+
+    Natural
+        height, /**< Number of node levels, zero when empty. */
+        count; /**< Number of elements in the tree. */
+};
+
+/**
+ * @brief
+ *     Tree position conformity.
+ * @details
+ *     This type is used to represent a position in a tree as a leaf and
+ *     the index of an element in that leaf.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Breadth
+ *     The maximum number of elements or children in a node.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+struct Foliar {
+
+    Locational<Ramal<Natural, Breadth, Elemental>>
+        leaf; /**< Leaf which holds the element. */
+
+    Natural
+        index; /**< Index of the element in the leaf. */
+};
+
+/**
+ * @brief
+ *     Function type which simplifies declaration syntax.
+ * @details
+ *     Function type alias used to declare the function which exposes the
+ *     part of an element by which the tree is ordered.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Relative
+ *     Type of the ordered part of the elements.
+ */
+template <
+    typename Elemental,
+    typename Relative>
+using Relatable = Referential<const Relative>(
+    Referential<const Elemental>
+        element);
+
+/**
+ * @brief
+ *     Function type which simplifies declaration syntax.
+ * @details
+ *     Function type alias used to declare the function which sets a
+ *     position to the element at which a scale begins.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Breadth
+ *     The maximum number of elements or children in a node.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+using Original = Referential<const Foliar<Natural, Breadth, Elemental>>(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position);
+
+/**
+ * @brief
+ *     Function type which simplifies declaration syntax.
+ * @details
+ *     Function type alias used to declare the function which moves a
+ *     position by an offset in the direction of a scale.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Breadth
+ *     The maximum number of elements or children in a node.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+using Subsequent = Referential<const Foliar<Natural, Breadth, Elemental>>(
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count);
+
+/**
+ * @brief
+ *     Node breadth which fits a memory extent.
+ * @details
+ *     The largest breadth for which a node fits in the specified number of
+ *     bytes, such as the size of a cache line or a memory page, but never
+ *     less than four.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Extent
+ *     Number of bytes a node should fit in.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Extent>
+constexpr Natural
+    Fanout = (Extent - sizeof(Natural)) / (sizeof(Elemental) + sizeof(Locational<Elemental>)) < 4
+    ? 4
+    : (Extent - sizeof(Natural)) / (sizeof(Elemental) + sizeof(Locational<Elemental>));
+
+/**
+ * @brief
+ *     Initialized tree.
+ * @details
+ *     Initialized tree value which can be used to initialize an instance
+ *     of the same tree type.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Breadth
+ *     The maximum number of elements or children in a node.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Arboreal<Natural, Breadth, Elemental>
+    InitializedTree = { 0, 0, 0, 0, 0 };
+
+/**
+ * @brief
+ *     Initializes a tree.
+ * @details
+ *     Sets the tree to the empty state without releasing any nodes, so it
+ *     must only be used on a tree which holds no nodes.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Referential<Arboreal<Natural, Breadth, Elemental>>
+Initialize(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    tree.root = tree.first = tree.last = 0;
+    tree.height = tree.count = 0;
+    return tree;
+}
+
+/**
+ * @brief
+ *     Exposes a whole element as its ordered part.
+ * @details
+ *     Used as the relator exposing function of trees ordered by their
+ *     entire elements.
+ */
+template <typename Elemental>
+static inline Referential<const Elemental>
+Identify(
+    Referential<const Elemental>
+        element)
+{
+    return element;
+}
+
+/**
+ * @brief
+ *     Reports the number of elements in a tree.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Natural
+Account(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return tree.count;
+}
+
+/**
+ * @brief
+ *     Prepares a tree for a number of elements.
+ * @details
+ *     Nodes are claimed one at a time as leaves split and the tree keeps
+ *     no spare nodes, so this implementation does nothing and always
+ *     returns false, which is not an error but an indication that no
+ *     space was prepared.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+Prepare(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return false;
+}
+
+/**
+ * @brief
+ *     Releases temporary space used by a tree.
+ * @details
+ *     Emptied nodes are disclaimed as soon as they are merged away and the
+ *     tree keeps no spare nodes, so this implementation does nothing and
+ *     always returns false, meaning that there is no more space to
+ *     release.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+Dispose(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return false;
+}
+
+/**
+ * @brief
+ *     Searches a node for the first element which is not ordered before
+ *     the relator.
+ * @details
+ *     Bisects the elements of the node and returns the index of the first
+ *     element which is not ordered before the relator, or the node count
+ *     if there is none.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    typename Relative,
+    Referential<Relatable<Elemental, Relative>> Relate,
+    Referential<Assortive<Relative>> Order>
+static inline Natural
+Bound(
+    const Locational<const Ramal<Natural, Breadth, Elemental>>
+        node,
+    Referential<const Relative>
+        relator)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural low, high, middle;
+    low = 0;
+    high = node->count;
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        if (Order(Relate(node->elements[middle]), relator))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief
+ *     Searches a branch for the child subtree which would hold the
+ *     relator.
+ * @details
+ *     Bisects the least elements of the children and returns the index of
+ *     the last child whose least element is not ordered after the
+ *     relator, or zero if there is none.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    typename Relative,
+    Referential<Relatable<Elemental, Relative>> Relate,
+    Referential<Assortive<Relative>> Order>
+static inline Natural
+Ramify(
+    const Locational<const Ramal<Natural, Breadth, Elemental>>
+        node,
+    Referential<const Relative>
+        relator)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural low, high, middle;
+    low = 0;
+    high = node->count;
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        if (Order(relator, Relate(node->elements[middle])))
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    return low > 0 ? low - 1 : 0;
+}
+
+/**
+ * @brief
+ *     Searches the tree for the relator.
+ * @details
+ *     Descends to the leaf which would hold the relator and sets the
+ *     position to the first element of that leaf which is not ordered
+ *     before the relator.  The index will equal the leaf count if every
+ *     element of the leaf is ordered before the relator.  Returns true
+ *     only if the element at the position equates to the relator.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    typename Relative,
+    Referential<Relatable<Elemental, Relative>> Relate,
+    Referential<Assortive<Relative>> Equate,
+    Referential<Assortive<Relative>> Order>
+static inline bool
+Seek(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Relative>
+        relator,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    static auto& BoundLeaf = Bound<Natural, Breadth, Elemental, Relative, Relate, Order>;
+    static auto& RamifyBranch = Ramify<Natural, Breadth, Elemental, Relative, Relate, Order>;
+    NodeLocational node;
+    Natural level;
+    position.leaf = node = tree.root;
+    position.index = 0;
+    if (!node)
+        return false;
+    for (level = tree.height; level > 1; level--)
+        node = node->links[RamifyBranch(node, relator)];
+    position.leaf = node;
+    position.index = BoundLeaf(node, relator);
+    if (position.index == node->count)
+        return false;
+    return Equate(Relate(node->elements[position.index]), relator);
+}
+
+/**
+ * @brief
+ *     Splits a full child of a branch in half.
+ * @details
+ *     Moves the upper half of the child into a newly claimed sibling which
+ *     is linked into the branch after the child.  The branch must not be
+ *     full.  Returns false without affecting the tree if a node could not
+ *     be claimed.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline bool
+Split(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    const Locational<Ramal<Natural, Breadth, Elemental>>
+        branch,
+    const Natural
+        index,
+    const bool
+        leaf)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    static const Natural Half = Breadth / 2;
+    const NodeLocational node = branch->links[index];
+    NodeLocational sibling;
+    Natural moved, offset;
+    if (!Allocator.claim(sibling))
+        return false;
+    moved = node->count - Half;
+    for (offset = 0; offset < moved; offset++)
+        sibling->elements[offset] = node->elements[Half + offset];
+    if (leaf) {
+        sibling->links[0] = node;
+        sibling->links[1] = node->links[1];
+        if (node->links[1])
+            node->links[1]->links[0] = sibling;
+        else
+            tree.last = sibling;
+        node->links[1] = sibling;
+    } else {
+        for (offset = 0; offset < moved; offset++)
+            sibling->links[offset] = node->links[Half + offset];
+    }
+    sibling->count = moved;
+    node->count = Half;
+    for (offset = branch->count; offset > index + 1; offset--) {
+        branch->elements[offset] = branch->elements[offset - 1];
+        branch->links[offset] = branch->links[offset - 1];
+    }
+    branch->elements[index + 1] = sibling->elements[0];
+    branch->links[index + 1] = sibling;
+    branch->count++;
+    return true;
+}
+
+/**
+ * @brief
+ *     Merges a child of a branch with the next child.
+ * @details
+ *     Appends the next child to the child, unlinks it from the branch and
+ *     disclaims it.  Both children together must fit in one node.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline void
+Merge(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    const Locational<Ramal<Natural, Breadth, Elemental>>
+        branch,
+    const Natural
+        index,
+    const bool
+        leaf)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    const NodeLocational node = branch->links[index];
+    NodeLocational sibling = branch->links[index + 1];
+    Natural offset;
+    for (offset = 0; offset < sibling->count; offset++)
+        node->elements[node->count + offset] = sibling->elements[offset];
+    if (leaf) {
+        node->links[1] = sibling->links[1];
+        if (sibling->links[1])
+            sibling->links[1]->links[0] = node;
+        else
+            tree.last = node;
+    } else {
+        for (offset = 0; offset < sibling->count; offset++)
+            node->links[node->count + offset] = sibling->links[offset];
+    }
+    node->count += sibling->count;
+    for (offset = index + 1; offset < branch->count - 1; offset++) {
+        branch->elements[offset] = branch->elements[offset + 1];
+        branch->links[offset] = branch->links[offset + 1];
+    }
+    branch->count--;
+    Allocator.disclaim(sibling);
+}
+
+/**
+ * @brief
+ *     Ensures a child of a branch holds more than the minimum count.
+ * @details
+ *     Moves one element or child from a neighbouring sibling which holds
+ *     more than half the breadth, otherwise merges the child with a
+ *     sibling.  Returns the index of the branch child which now holds the
+ *     contents of the original child.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline Natural
+Replenish(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    const Locational<Ramal<Natural, Breadth, Elemental>>
+        branch,
+    const Natural
+        index,
+    const bool
+        leaf)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    static auto& MergeChildren = Merge<Natural, Breadth, Elemental, Allocator>;
+    static const Natural Half = Breadth / 2;
+    const NodeLocational node = branch->links[index];
+    NodeLocational sibling;
+    Natural offset;
+    if (index > 0 && branch->links[index - 1]->count > Half) {
+        sibling = branch->links[index - 1];
+        for (offset = node->count; offset > 0; offset--)
+            node->elements[offset] = node->elements[offset - 1];
+        node->elements[0] = sibling->elements[sibling->count - 1];
+        if (!leaf) {
+            for (offset = node->count; offset > 0; offset--)
+                node->links[offset] = node->links[offset - 1];
+            node->links[0] = sibling->links[sibling->count - 1];
+        }
+        sibling->count--;
+        node->count++;
+        branch->elements[index] = node->elements[0];
+        return index;
+    }
+    if (index + 1 < branch->count && branch->links[index + 1]->count > Half) {
+        sibling = branch->links[index + 1];
+        node->elements[node->count] = sibling->elements[0];
+        for (offset = 1; offset < sibling->count; offset++)
+            sibling->elements[offset - 1] = sibling->elements[offset];
+        if (!leaf) {
+            node->links[node->count] = sibling->links[0];
+            for (offset = 1; offset < sibling->count; offset++)
+                sibling->links[offset - 1] = sibling->links[offset];
+        }
+        sibling->count--;
+        node->count++;
+        branch->elements[index + 1] = sibling->elements[0];
+        return index;
+    }
+    if (index + 1 < branch->count) {
+        MergeChildren(tree, branch, index, leaf);
+        return index;
+    }
+    MergeChildren(tree, branch, index - 1, leaf);
+    return index - 1;
+}
+
+/**
+ * @brief
+ *     Grafts an element into the tree.
+ * @details
+ *     Descends from the root to the leaf which should hold the element,
+ *     splitting every full node on the way so that a split never has to
+ *     propagate upwards.  The element must not already exist in the tree.
+ *     Returns false if a node could not be claimed, in which case the tree
+ *     remains valid but the element is not grafted.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    typename Relative,
+    Referential<Relatable<Elemental, Relative>> Relate,
+    Referential<Assortive<Relative>> Order,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline bool
+Graft(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Elemental>
+        value)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        Breadth >= 4,
+        "Breadth:  At least four elements per node required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    static auto& BoundLeaf = Bound<Natural, Breadth, Elemental, Relative, Relate, Order>;
+    static auto& RamifyBranch = Ramify<Natural, Breadth, Elemental, Relative, Relate, Order>;
+    static auto& SplitChild = Split<Natural, Breadth, Elemental, Allocator>;
+    Referential<const Relative> relator = Relate(value);
+    NodeLocational node;
+    Natural level, index, offset;
+    if (!tree.root) {
+        if (!Allocator.claim(node))
+            return false;
+        node->count = 0;
+        node->links[0] = node->links[1] = 0;
+        tree.root = tree.first = tree.last = node;
+        tree.height = 1;
+    } else if (tree.root->count == Breadth) {
+        if (!Allocator.claim(node))
+            return false;
+        node->count = 1;
+        node->elements[0] = tree.root->elements[0];
+        node->links[0] = tree.root;
+        if (!SplitChild(tree, node, 0, tree.height == 1)) {
+            Allocator.disclaim(node);
+            return false;
+        }
+        tree.root = node;
+        tree.height++;
+    }
+    node = tree.root;
+    for (level = tree.height; level > 1; level--) {
+        if (Order(relator, Relate(node->elements[0])))
+            node->elements[0] = value;
+        index = RamifyBranch(node, relator);
+        if (node->links[index]->count == Breadth) {
+            if (!SplitChild(tree, node, index, level == 2))
+                return false;
+            if (!Order(relator, Relate(node->elements[index + 1])))
+                index++;
+        }
+        node = node->links[index];
+    }
+    index = BoundLeaf(node, relator);
+    for (offset = node->count; offset > index; offset--)
+        node->elements[offset] = node->elements[offset - 1];
+    node->elements[index] = value;
+    node->count++;
+    tree.count++;
+    return true;
+}
+
+/**
+ * @brief
+ *     Prunes an element from the tree.
+ * @details
+ *     Descends from the root to the leaf which holds the element, refilling
+ *     every child holding the minimum count on the way so that a merge
+ *     never has to propagate upwards.  The root is replaced by its only
+ *     child whenever merging leaves it with a single child.  Returns false
+ *     without affecting the tree if the relator does not exist.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    typename Relative,
+    Referential<Relatable<Elemental, Relative>> Relate,
+    Referential<Assortive<Relative>> Equate,
+    Referential<Assortive<Relative>> Order,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline bool
+Prune(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Relative>
+        relator)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    static auto& SeekRelator = Seek<Natural, Breadth, Elemental, Relative, Relate, Equate, Order>;
+    static auto& BoundLeaf = Bound<Natural, Breadth, Elemental, Relative, Relate, Order>;
+    static auto& RamifyBranch = Ramify<Natural, Breadth, Elemental, Relative, Relate, Order>;
+    static auto& ReplenishChild = Replenish<Natural, Breadth, Elemental, Allocator>;
+    static const Natural Half = Breadth / 2;
+    Foliar<Natural, Breadth, Elemental> position;
+    NodeLocational node, root;
+    Natural level, index, offset;
+    if (!SeekRelator(tree, relator, position))
+        return false;
+    node = tree.root;
+    for (level = tree.height; level > 1; level--) {
+        index = RamifyBranch(node, relator);
+        if (node->links[index]->count <= Half)
+            index = ReplenishChild(tree, node, index, level == 2);
+        if (node == tree.root && node->count == 1) {
+            root = node;
+            tree.root = node = node->links[0];
+            tree.height--;
+            Allocator.disclaim(root);
+            continue;
+        }
+        node = node->links[index];
+    }
+    index = BoundLeaf(node, relator);
+    for (offset = index + 1; offset < node->count; offset++)
+        node->elements[offset - 1] = node->elements[offset];
+    node->count--;
+    tree.count--;
+    if (node->count == 0) {
+        Allocator.disclaim(node);
+        tree.root = tree.first = tree.last = 0;
+        tree.height = 0;
+    }
+    return true;
+}
+
+/**
+ * @brief
+ *     Disclaims a node and every node beneath it.
+ * @details
+ *     The level is the number of node levels from the node down to the
+ *     leaves, where one means the node is a leaf.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline void
+Raze(
+    Locational<Ramal<Natural, Breadth, Elemental>>
+        node,
+    const Natural
+        level)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural index;
+    if (level > 1) {
+        for (index = 0; index < node->count; index++)
+            Raze<Natural, Breadth, Elemental, Allocator>(node->links[index], level - 1);
+    }
+    Allocator.disclaim(node);
+}
+
+/**
+ * @brief
+ *     Removes all elements from the tree.
+ * @details
+ *     Disclaims every node of the tree.  Returns false if the tree was
+ *     already empty.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+static inline bool
+Fell(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (!tree.root)
+        return false;
+    Raze<Natural, Breadth, Elemental, Allocator>(tree.root, tree.height);
+    tree.root = tree.first = tree.last = 0;
+    tree.height = tree.count = 0;
+    return true;
+}
+
+/**
+ * @brief
+ *     Sets a position to the first element of a tree.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+SetFirst(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    position.leaf = tree.first;
+    position.index = 0;
+    return position;
+}
+
+/**
+ * @brief
+ *     Sets a position to the last element of a tree.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+SetLast(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    position.leaf = tree.last;
+    position.index = tree.last ? tree.last->count - 1 : 0;
+    return position;
+}
+
+/**
+ * @brief
+ *     Moves a position forward.
+ * @details
+ *     Skips whole leaves at a time using the leaf counts, so the cost is
+ *     proportional to the number of leaves crossed rather than the number
+ *     of elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+Advance(
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural remaining, available;
+    remaining = count;
+    while (remaining > 0) {
+        available = position.leaf->count - 1 - position.index;
+        if (remaining <= available) {
+            position.index += remaining;
+            break;
+        }
+        remaining -= available + 1;
+        position.leaf = position.leaf->links[1];
+        position.index = 0;
+    }
+    return position;
+}
+
+/**
+ * @brief
+ *     Moves a position backward.
+ * @details
+ *     Skips whole leaves at a time using the leaf counts, so the cost is
+ *     proportional to the number of leaves crossed rather than the number
+ *     of elements.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+Retreat(
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural remaining;
+    remaining = count;
+    while (remaining > 0) {
+        if (remaining <= position.index) {
+            position.index -= remaining;
+            break;
+        }
+        remaining -= position.index + 1;
+        position.leaf = position.leaf->links[0];
+        position.index = position.leaf->count - 1;
+    }
+    return position;
+}
+
+/**
+ * @brief
+ *     Counts the elements after a position.
+ * @details
+ *     Stops counting whole leaves once the limit is reached, so the result
+ *     is only exact when it is less than the limit.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Natural
+Following(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        limit)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    NodeLocational leaf;
+    Natural count;
+    count = position.leaf->count - 1 - position.index;
+    for (leaf = position.leaf->links[1]; leaf && count < limit; leaf = leaf->links[1])
+        count += leaf->count;
+    return count;
+}
+
+/**
+ * @brief
+ *     Counts the elements before a position.
+ * @details
+ *     Stops counting whole leaves once the limit is reached, so the result
+ *     is only exact when it is less than the limit.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Natural
+Preceding(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        limit)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    NodeLocational leaf;
+    Natural count;
+    count = position.index;
+    for (leaf = position.leaf->links[0]; leaf && count < limit; leaf = leaf->links[0])
+        count += leaf->count;
+    return count;
+}
+
+/**
+ * @brief
+ *     Begins a scale at an offset from an end of a tree.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<Original<Natural, Breadth, Elemental>> GetOrigin,
+    Referential<Subsequent<Natural, Breadth, Elemental>> Move>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+BeginReadScale(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    GetOrigin(tree, position);
+    return Move(position, count);
+}
+
+/**
+ * @brief
+ *     Begins a scale at an offset from an end of a writable tree.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<Original<Natural, Breadth, Elemental>> GetOrigin,
+    Referential<Subsequent<Natural, Breadth, Elemental>> Move>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+BeginWriteScale(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    GetOrigin(tree, position);
+    return Move(position, count);
+}
+
+/**
+ * @brief
+ *     Moves a position along a scale.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<Subsequent<Natural, Breadth, Elemental>> Move>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+TraverseReadScale(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return Move(position, count);
+}
+
+/**
+ * @brief
+ *     Moves a position along a scale of a writable tree.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<Subsequent<Natural, Breadth, Elemental>> Move>
+static inline Referential<const Foliar<Natural, Breadth, Elemental>>
+TraverseWriteScale(
+    Referential<Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return Move(position, count);
+}
+
+/**
+ * @brief
+ *     Determines if a direction can begin at an offset.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+DirectionBegins(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return count < tree.count;
+}
+
+/**
+ * @brief
+ *     Determines if a direction can be traversed from a position.
+ * @details
+ *     Counts the remaining elements only up to the offset, so the cost is
+ *     proportional to the number of leaves within the offset.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<Natural(Referential<const Foliar<Natural, Breadth, Elemental>>, Referential<const Natural>)> Remaining>
+static inline bool
+DirectionTraverses(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return Remaining(position, count) >= count;
+}
+
+/**
+ * @brief
+ *     Counts the elements after a position along a direction.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental,
+    Referential<Natural(Referential<const Foliar<Natural, Breadth, Elemental>>, Referential<const Natural>)> Remaining>
+static inline Natural
+Count(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return Remaining(position, tree.count);
+}
+
+/**
+ * @brief
+ *     Determines if a position refers to an element.
+ * @details
+ *     Only checks that the index is within the leaf, since positions are
+ *     invalidated whenever the tree is modified.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+Contains(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return position.leaf && position.index < position.leaf->count;
+}
+
+/**
+ * @brief
+ *     Exposes the element at a position.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline Conferential<const Elemental>
+GoRead(
+    Referential<const Arboreal<Natural, Breadth, Elemental>>
+        tree,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        position)
+{
+    using ::location::Deter;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    static auto& DeterElement = Deter<Elemental>;
+    return DeterElement(position.leaf->elements[position.index]);
+}
+
+/**
+ * @brief
+ *     Determines if two positions are equal.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+IsEqual(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        base,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        relative)
+{
+    return base.leaf == relative.leaf && base.index == relative.index;
+}
+
+/**
+ * @brief
+ *     Determines if two positions are not equal.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+IsNotEqual(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        base,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        relative)
+{
+    return base.leaf != relative.leaf || base.index != relative.index;
+}
+
+/**
+ * @brief
+ *     Determines if a position is before another.
+ * @details
+ *     Walks the leaf chain forward from the first position when the
+ *     positions are in different leaves.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+IsLesser(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        base,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        relative)
+{
+    using NodeLocational = Locational<Ramal<Natural, Breadth, Elemental>>;
+    NodeLocational leaf;
+    if (base.leaf == relative.leaf)
+        return base.index < relative.index;
+    for (leaf = base.leaf->links[1]; leaf; leaf = leaf->links[1]) {
+        if (leaf == relative.leaf)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief
+ *     Determines if a position is after another.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+IsGreater(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        base,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        relative)
+{
+    return IsLesser<Natural, Breadth, Elemental>(relative, base);
+}
+
+/**
+ * @brief
+ *     Determines if a position is not after another.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+IsNotGreater(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        base,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        relative)
+{
+    return !IsLesser<Natural, Breadth, Elemental>(relative, base);
+}
+
+/**
+ * @brief
+ *     Determines if a position is not before another.
+ */
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+static inline bool
+IsNotLesser(
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        base,
+    Referential<const Foliar<Natural, Breadth, Elemental>>
+        relative)
+{
+    return !IsLesser<Natural, Breadth, Elemental>(base, relative);
+}
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Equative<Foliar<Natural, Breadth, Elemental>>
+    FoliarEquality = {
+        IsEqual<Natural, Breadth, Elemental>,
+        IsNotEqual<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Relational<Foliar<Natural, Breadth, Elemental>>
+    FoliarRelation = {
+        IsLesser<Natural, Breadth, Elemental>,
+        IsGreater<Natural, Breadth, Elemental>,
+        IsNotGreater<Natural, Breadth, Elemental>,
+        IsNotLesser<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Comparative<Foliar<Natural, Breadth, Elemental>>
+    FoliarComparison = {
+        FoliarEquality<Natural, Breadth, Elemental>,
+        FoliarRelation<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Vectorial<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, const Elemental>
+    ReadVector = {
+        FoliarComparison<Natural, Breadth, Elemental>,
+        Contains<Natural, Breadth, Elemental>,
+        GoRead<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Scalar<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, const Elemental>
+    ReadIncrementScale = {
+        FoliarComparison<Natural, Breadth, Elemental>,
+        BeginReadScale<Natural, Breadth, Elemental, SetFirst<Natural, Breadth, Elemental>, Advance<Natural, Breadth, Elemental>>,
+        TraverseReadScale<Natural, Breadth, Elemental, Advance<Natural, Breadth, Elemental>>,
+        GoRead<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Scalar<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, const Elemental>
+    ReadDecrementScale = {
+        FoliarComparison<Natural, Breadth, Elemental>,
+        BeginReadScale<Natural, Breadth, Elemental, SetLast<Natural, Breadth, Elemental>, Retreat<Natural, Breadth, Elemental>>,
+        TraverseReadScale<Natural, Breadth, Elemental, Retreat<Natural, Breadth, Elemental>>,
+        GoRead<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Lineal<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, const Elemental>
+    ReadLiner = {
+        ReadIncrementScale<Natural, Breadth, Elemental>,
+        ReadDecrementScale<Natural, Breadth, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Directional<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, const Elemental>
+    ReadIncrementDirection = {
+        ReadIncrementScale<Natural, Breadth, Elemental>,
+        DirectionBegins<Natural, Breadth, Elemental>,
+        DirectionTraverses<Natural, Breadth, Elemental, Following<Natural, Breadth, Elemental>>,
+        Contains<Natural, Breadth, Elemental>,
+        Account<Natural, Breadth, Elemental>,
+        Count<Natural, Breadth, Elemental, Following<Natural, Breadth, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Directional<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, const Elemental>
+    ReadDecrementDirection = {
+        ReadDecrementScale<Natural, Breadth, Elemental>,
+        DirectionBegins<Natural, Breadth, Elemental>,
+        DirectionTraverses<Natural, Breadth, Elemental, Preceding<Natural, Breadth, Elemental>>,
+        Contains<Natural, Breadth, Elemental>,
+        Account<Natural, Breadth, Elemental>,
+        Count<Natural, Breadth, Elemental, Preceding<Natural, Breadth, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Breadth,
+    typename Elemental>
+constexpr Axial<const Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, const Elemental>
+    ReadAxis = {
+        ReadIncrementDirection<Natural, Breadth, Elemental>,
+        ReadDecrementDirection<Natural, Breadth, Elemental>
+    };
+
+}
+
+#endif
@@ -0,0 +1,547 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef ARBORATION_ASSOCIATION_MODULE
+#define ARBORATION_ASSOCIATION_MODULE
+#include <arboration.hpp>
+#include <association.hpp>
+
+namespace arboration {
+
+/**
+ * @brief
+ *     Chunked B+ tree sorted map management and trajection implementation.
+ * @details
+ *     Chunked B+ tree sorted map management and trajection implementation.
+ *     Mappings are ordered by relator (key) and scales traverse the leaf
+ *     chain in relator order.
+ */
+namespace association {
+
+    using ::association::Associative;
+    using ::association::Complementary;
+
+    /**
+     * @brief
+     *     Tree map node conformity.
+     * @details
+     *     This type alias is used to represent a tree map node.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Breadth
+     *     The maximum number of mappings or children in a node.
+     * @tparam Correlative
+     *     Type of the relator keys.
+     * @tparam Evaluative
+     *     Type of the value elements.
+     */
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    using AssociativelyRamal = Ramal<Natural, Breadth, Complementary<Correlative, Evaluative>>;
+
+    /**
+     * @brief
+     *     Tree map conformity.
+     * @details
+     *     This type alias is used to represent a tree map.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Breadth
+     *     The maximum number of mappings or children in a node.
+     * @tparam Correlative
+     *     Type of the relator keys.
+     * @tparam Evaluative
+     *     Type of the value elements.
+     */
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    using AssociativelyArboreal = Arboreal<Natural, Breadth, Complementary<Correlative, Evaluative>>;
+
+    /**
+     * @brief
+     *     Tree map position conformity.
+     * @details
+     *     This type alias is used to represent a tree map position.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Breadth
+     *     The maximum number of mappings or children in a node.
+     * @tparam Correlative
+     *     Type of the relator keys.
+     * @tparam Evaluative
+     *     Type of the value elements.
+     */
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    using AssociativelyFoliar = Foliar<Natural, Breadth, Complementary<Correlative, Evaluative>>;
+
+    template <
+        typename Correlative,
+        typename Evaluative>
+    static inline Referential<const Correlative>
+    Relate(
+        Referential<const Complementary<Correlative, Evaluative>>
+            pair)
+    {
+        return pair.relator;
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    static inline Conferential<const Correlative>
+    GoReadRelator(
+        Referential<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>>
+            position)
+    {
+        using ::location::Deter;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& DeterRelator = Deter<Correlative>;
+        return DeterRelator(position.leaf->elements[position.index].relator);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    static inline Conferential<const Evaluative>
+    GoReadElement(
+        Referential<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>>
+            position)
+    {
+        using ::location::Deter;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& DeterElement = Deter<Evaluative>;
+        return DeterElement(position.leaf->elements[position.index].value);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    static inline Conferential<Evaluative>
+    GoWriteElement(
+        Referential<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>>
+            position)
+    {
+        using ::location::Confer;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& ConferElement = Confer<Evaluative>;
+        return ConferElement(position.leaf->elements[position.index].value);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative,
+        Referential<Assortive<Correlative>> Equate,
+        Referential<Assortive<Correlative>> Order>
+    static inline bool
+    Correspond(
+        Referential<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const Correlative>
+            relator)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using MapComplementary = Complementary<Correlative, Evaluative>;
+        static auto& SeekRelator = Seek<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Equate, Order>;
+        AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative> position;
+        return SeekRelator(map, relator, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative,
+        Referential<Assortive<Correlative>> Equate,
+        Referential<Assortive<Correlative>> Order,
+        Referential<const DefaultAllocative<AssociativelyRamal<Natural, Breadth, Correlative, Evaluative>>> Allocator>
+    static inline bool
+    Associate(
+        Referential<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const Correlative>
+            relator,
+        Referential<const Evaluative>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using MapComplementary = Complementary<Correlative, Evaluative>;
+        static auto& SeekRelator = Seek<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Equate, Order>;
+        static auto& GraftPair = Graft<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Order, Allocator>;
+        const MapComplementary pair = { relator, value };
+        AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative> position;
+        if (SeekRelator(map, relator, position))
+            return false;
+        return GraftPair(map, pair);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative,
+        Referential<Assortive<Correlative>> Equate,
+        Referential<Assortive<Correlative>> Order,
+        Referential<const DefaultAllocative<AssociativelyRamal<Natural, Breadth, Correlative, Evaluative>>> Allocator>
+    static inline bool
+    Reassociate(
+        Referential<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const Correlative>
+            original,
+        Referential<const Correlative>
+            replacement)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using MapComplementary = Complementary<Correlative, Evaluative>;
+        static auto& SeekRelator = Seek<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Equate, Order>;
+        static auto& GraftPair = Graft<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Order, Allocator>;
+        static auto& PrunePair = Prune<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Equate, Order, Allocator>;
+        AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative> original_position, replacement_position;
+        if (!SeekRelator(map, original, original_position))
+            return false;
+        if (SeekRelator(map, replacement, replacement_position))
+            return false;
+        const MapComplementary pair = { replacement, original_position.leaf->elements[original_position.index].value };
+        if (!GraftPair(map, pair))
+            return false;
+        return PrunePair(map, original);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative,
+        Referential<Assortive<Correlative>> Equate,
+        Referential<Assortive<Correlative>> Order,
+        Referential<const DefaultAllocative<AssociativelyRamal<Natural, Breadth, Correlative, Evaluative>>> Allocator>
+    static inline bool
+    Disassociate(
+        Referential<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>>
+            map,
+        Referential<const Correlative>
+            relator)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using MapComplementary = Complementary<Correlative, Evaluative>;
+        static auto& PrunePair = Prune<Natural, Breadth, MapComplementary, Correlative, Relate<Correlative, Evaluative>, Equate, Order, Allocator>;
+        return PrunePair(map, relator);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Scalar<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Correlative>
+        ReadRelatorIncrementScale = {
+            FoliarComparison<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            BeginReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, SetFirst<Natural, Breadth, Complementary<Correlative, Evaluative>>, Advance<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            TraverseReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, Advance<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            GoReadRelator<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Scalar<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Correlative>
+        ReadRelatorDecrementScale = {
+            FoliarComparison<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            BeginReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, SetLast<Natural, Breadth, Complementary<Correlative, Evaluative>>, Retreat<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            TraverseReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, Retreat<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            GoReadRelator<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Scalar<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Evaluative>
+        ReadElementIncrementScale = {
+            FoliarComparison<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            BeginReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, SetFirst<Natural, Breadth, Complementary<Correlative, Evaluative>>, Advance<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            TraverseReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, Advance<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            GoReadElement<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Scalar<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Evaluative>
+        ReadElementDecrementScale = {
+            FoliarComparison<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            BeginReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, SetLast<Natural, Breadth, Complementary<Correlative, Evaluative>>, Retreat<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            TraverseReadScale<Natural, Breadth, Complementary<Correlative, Evaluative>, Retreat<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            GoReadElement<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Scalar<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, Evaluative>
+        WriteElementIncrementScale = {
+            FoliarComparison<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            BeginWriteScale<Natural, Breadth, Complementary<Correlative, Evaluative>, SetFirst<Natural, Breadth, Complementary<Correlative, Evaluative>>, Advance<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            TraverseWriteScale<Natural, Breadth, Complementary<Correlative, Evaluative>, Advance<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            GoWriteElement<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Scalar<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, Evaluative>
+        WriteElementDecrementScale = {
+            FoliarComparison<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            BeginWriteScale<Natural, Breadth, Complementary<Correlative, Evaluative>, SetLast<Natural, Breadth, Complementary<Correlative, Evaluative>>, Retreat<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            TraverseWriteScale<Natural, Breadth, Complementary<Correlative, Evaluative>, Retreat<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            GoWriteElement<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Lineal<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Correlative>
+        ReadRelatorLiner = {
+            ReadRelatorIncrementScale<Natural, Breadth, Correlative, Evaluative>,
+            ReadRelatorDecrementScale<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Lineal<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Evaluative>
+        ReadElementLiner = {
+            ReadElementIncrementScale<Natural, Breadth, Correlative, Evaluative>,
+            ReadElementDecrementScale<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Lineal<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, Evaluative>
+        WriteElementLiner = {
+            WriteElementIncrementScale<Natural, Breadth, Correlative, Evaluative>,
+            WriteElementDecrementScale<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Directional<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Correlative>
+        ReadRelatorIncrementDirection = {
+            ReadRelatorIncrementScale<Natural, Breadth, Correlative, Evaluative>,
+            DirectionBegins<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            DirectionTraverses<Natural, Breadth, Complementary<Correlative, Evaluative>, Following<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            Contains<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Count<Natural, Breadth, Complementary<Correlative, Evaluative>, Following<Natural, Breadth, Complementary<Correlative, Evaluative>>>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Directional<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Correlative>
+        ReadRelatorDecrementDirection = {
+            ReadRelatorDecrementScale<Natural, Breadth, Correlative, Evaluative>,
+            DirectionBegins<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            DirectionTraverses<Natural, Breadth, Complementary<Correlative, Evaluative>, Preceding<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            Contains<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Count<Natural, Breadth, Complementary<Correlative, Evaluative>, Preceding<Natural, Breadth, Complementary<Correlative, Evaluative>>>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Directional<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Evaluative>
+        ReadElementIncrementDirection = {
+            ReadElementIncrementScale<Natural, Breadth, Correlative, Evaluative>,
+            DirectionBegins<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            DirectionTraverses<Natural, Breadth, Complementary<Correlative, Evaluative>, Following<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            Contains<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Count<Natural, Breadth, Complementary<Correlative, Evaluative>, Following<Natural, Breadth, Complementary<Correlative, Evaluative>>>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Directional<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Evaluative>
+        ReadElementDecrementDirection = {
+            ReadElementDecrementScale<Natural, Breadth, Correlative, Evaluative>,
+            DirectionBegins<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            DirectionTraverses<Natural, Breadth, Complementary<Correlative, Evaluative>, Preceding<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            Contains<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Count<Natural, Breadth, Complementary<Correlative, Evaluative>, Preceding<Natural, Breadth, Complementary<Correlative, Evaluative>>>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Directional<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, Evaluative>
+        WriteElementIncrementDirection = {
+            WriteElementIncrementScale<Natural, Breadth, Correlative, Evaluative>,
+            DirectionBegins<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            DirectionTraverses<Natural, Breadth, Complementary<Correlative, Evaluative>, Following<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            Contains<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Count<Natural, Breadth, Complementary<Correlative, Evaluative>, Following<Natural, Breadth, Complementary<Correlative, Evaluative>>>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Directional<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, Evaluative>
+        WriteElementDecrementDirection = {
+            WriteElementDecrementScale<Natural, Breadth, Correlative, Evaluative>,
+            DirectionBegins<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            DirectionTraverses<Natural, Breadth, Complementary<Correlative, Evaluative>, Preceding<Natural, Breadth, Complementary<Correlative, Evaluative>>>,
+            Contains<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Count<Natural, Breadth, Complementary<Correlative, Evaluative>, Preceding<Natural, Breadth, Complementary<Correlative, Evaluative>>>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Axial<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Correlative>
+        ReadRelatorAxis = {
+            ReadRelatorIncrementDirection<Natural, Breadth, Correlative, Evaluative>,
+            ReadRelatorDecrementDirection<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Axial<const AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, const Evaluative>
+        ReadElementAxis = {
+            ReadElementIncrementDirection<Natural, Breadth, Correlative, Evaluative>,
+            ReadElementDecrementDirection<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative>
+    constexpr Axial<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, AssociativelyFoliar<Natural, Breadth, Correlative, Evaluative>, Natural, Evaluative>
+        WriteElementAxis = {
+            WriteElementIncrementDirection<Natural, Breadth, Correlative, Evaluative>,
+            WriteElementDecrementDirection<Natural, Breadth, Correlative, Evaluative>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Correlative,
+        typename Evaluative,
+        Referential<Assortive<Correlative>> Equate,
+        Referential<Assortive<Correlative>> Order,
+        Referential<const DefaultAllocative<AssociativelyRamal<Natural, Breadth, Correlative, Evaluative>>> Allocator>
+    constexpr Associative<AssociativelyArboreal<Natural, Breadth, Correlative, Evaluative>, Natural, Correlative, Evaluative>
+        Associator = {
+            Prepare<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Account<Natural, Breadth, Complementary<Correlative, Evaluative>>,
+            Correspond<Natural, Breadth, Correlative, Evaluative, Equate, Order>,
+            Associate<Natural, Breadth, Correlative, Evaluative, Equate, Order, Allocator>,
+            Reassociate<Natural, Breadth, Correlative, Evaluative, Equate, Order, Allocator>,
+            Disassociate<Natural, Breadth, Correlative, Evaluative, Equate, Order, Allocator>,
+            Fell<Natural, Breadth, Complementary<Correlative, Evaluative>, Allocator>,
+            Dispose<Natural, Breadth, Complementary<Correlative, Evaluative>>
+        };
+
+}
+
+}
+
+#endif
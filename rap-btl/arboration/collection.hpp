@@ -0,0 +1,867 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef ARBORATION_COLLECTION_MODULE
+#define ARBORATION_COLLECTION_MODULE
+#include <arboration.hpp>
+#include <collection.hpp>
+
+namespace arboration {
+
+/**
+ * @brief
+ *     Chunked B+ tree sorted set management implementation.
+ * @details
+ *     Chunked B+ tree sorted set management implementation.  Duplicate
+ *     elements are always refused.  Set operations with sorted operands
+ *     merge both operands in a single pass each, while set operations with
+ *     unsorted operands search the opposing operand sequentially.
+ */
+namespace collection {
+
+    using ::collection::Bisectional;
+    using ::collection::Collective;
+    using ::collection::EquateCollections;
+    using ::composition::Compositional;
+    using ::selection::EquateSelections;
+    using ::selection::Sectional;
+    using ::selection::Selective;
+    using ::sortation::SearchSection;
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order>
+    static inline bool
+    AccreditCollection(
+        Referential<const Arboreal<Natural, Breadth, Elemental>>
+            set,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SeekElement = Seek<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Equate, Order>;
+        Foliar<Natural, Breadth, Elemental> position;
+        return SeekElement(set, value, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    ComposeCollection(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            set,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SeekElement = Seek<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Equate, Order>;
+        static auto& GraftElement = Graft<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Order, Allocator>;
+        Foliar<Natural, Breadth, Elemental> position;
+        if (SeekElement(set, value, position))
+            return false;
+        return GraftElement(set, value);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    RecomposeCollection(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            set,
+        Referential<const Elemental>
+            original,
+        Referential<const Elemental>
+            replacement)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SeekElement = Seek<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Equate, Order>;
+        static auto& GraftElement = Graft<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Order, Allocator>;
+        static auto& PruneElement = Prune<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Equate, Order, Allocator>;
+        Foliar<Natural, Breadth, Elemental> position;
+        if (!SeekElement(set, original, position))
+            return false;
+        if (SeekElement(set, replacement, position))
+            return false;
+        if (!GraftElement(set, replacement))
+            return false;
+        return PruneElement(set, original);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    DiscomposeCollection(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            set,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& PruneElement = Prune<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Equate, Order, Allocator>;
+        return PruneElement(set, value);
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    Incorporate(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            set,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SeekElement = Seek<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Equate, Order>;
+        static auto& GraftElement = Graft<Natural, Breadth, Elemental, Elemental, Identify<Elemental>, Order, Allocator>;
+        Foliar<Natural, Breadth, Elemental> position;
+        if (SeekElement(set, value, position))
+            return true;
+        return GraftElement(set, value);
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    Assemble(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<BasicNatural>::value && is_unsigned<BasicNatural>::value,
+            "BasicNatural:  Unsigned integer type required");
+#endif
+        static auto& IncorporateElement = Incorporate<Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        BasicPositional position;
+        if (!basis.begins(base_set, 0))
+            return true;
+        basis.scale.begin(base_set, position, 0);
+        while (true) {
+            if (!IncorporateElement(operand, basis.scale.go(base_set, position).to))
+                return false;
+            if (!basis.traverses(base_set, position, 1))
+                return true;
+            basis.scale.traverse(base_set, position, 1);
+        }
+    }
+
+    /**
+     * @brief
+     *     Incorporates the base set elements which are or are not found in
+     *     the relative set.
+     * @details
+     *     The relative set is searched sequentially for each element of the
+     *     base set, which is incorporated into the operand if the outcome
+     *     matches the inclusive template argument.
+     */
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator,
+        const bool Inclusive>
+    static inline bool
+    Sift(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set,
+        Referential<const Directional<const Relative, RelativePositional, RelativeNatural, const Elemental>>
+            relativity,
+        Referential<const Relative>
+            relative_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<BasicNatural>::value && is_unsigned<BasicNatural>::value,
+            "BasicNatural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using ElementReferential = Referential<const Elemental>;
+        static auto& IncorporateElement = Incorporate<Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        static auto& AssembleBase = Assemble<Basic, BasicPositional, BasicNatural, Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        BasicPositional position;
+        RelativePositional opposition;
+        RelativeNatural extent;
+        if (!relativity.begins(relative_set, 0))
+            return Inclusive ? true : AssembleBase(operand, basis, base_set);
+        if (!basis.begins(base_set, 0))
+            return true;
+        extent = relativity.survey(relative_set) - 1;
+        basis.scale.begin(base_set, position, 0);
+        while (true) {
+            ElementReferential base_value = basis.scale.go(base_set, position).to;
+            relativity.scale.begin(relative_set, opposition, 0);
+            if (SearchSection(relative_set, relativity.scale, base_value, opposition, extent, Equate) == Inclusive) {
+                if (!IncorporateElement(operand, base_value))
+                    return false;
+            }
+            if (!basis.traverses(base_set, position, 1))
+                return true;
+            basis.scale.traverse(base_set, position, 1);
+        }
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    CollateSelection(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& AssembleBase = Assemble<Basic, BasicPositional, BasicNatural, Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        return AssembleBase(operand, basis, base_set);
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    ComplementSelections(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set,
+        Referential<const Directional<const Relative, RelativePositional, RelativeNatural, const Elemental>>
+            relativity,
+        Referential<const Relative>
+            relative_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SiftRelative = Sift<Relative, RelativePositional, RelativeNatural, Basic, BasicPositional, BasicNatural, Natural, Breadth, Elemental, Equate, Order, Allocator, false>;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        return SiftRelative(operand, relativity, relative_set, basis, base_set);
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    DifferentiateSelections(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set,
+        Referential<const Directional<const Relative, RelativePositional, RelativeNatural, const Elemental>>
+            relativity,
+        Referential<const Relative>
+            relative_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SiftBase = Sift<Basic, BasicPositional, BasicNatural, Relative, RelativePositional, RelativeNatural, Natural, Breadth, Elemental, Equate, Order, Allocator, false>;
+        static auto& SiftRelative = Sift<Relative, RelativePositional, RelativeNatural, Basic, BasicPositional, BasicNatural, Natural, Breadth, Elemental, Equate, Order, Allocator, false>;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        if (!SiftBase(operand, basis, base_set, relativity, relative_set))
+            return false;
+        return SiftRelative(operand, relativity, relative_set, basis, base_set);
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    IntersectSelections(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set,
+        Referential<const Directional<const Relative, RelativePositional, RelativeNatural, const Elemental>>
+            relativity,
+        Referential<const Relative>
+            relative_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& SiftBase = Sift<Basic, BasicPositional, BasicNatural, Relative, RelativePositional, RelativeNatural, Natural, Breadth, Elemental, Equate, Order, Allocator, true>;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        return SiftBase(operand, basis, base_set, relativity, relative_set);
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    UniteSelections(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Directional<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set,
+        Referential<const Directional<const Relative, RelativePositional, RelativeNatural, const Elemental>>
+            relativity,
+        Referential<const Relative>
+            relative_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& AssembleBase = Assemble<Basic, BasicPositional, BasicNatural, Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        static auto& AssembleRelative = Assemble<Relative, RelativePositional, RelativeNatural, Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        if (!AssembleBase(operand, basis, base_set))
+            return false;
+        return AssembleRelative(operand, relativity, relative_set);
+    }
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    static inline bool
+    CollateCollection(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Axial<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& AssembleBase = Assemble<Basic, BasicPositional, BasicNatural, Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        return AssembleBase(operand, basis.increment, base_set);
+    }
+
+    /**
+     * @brief
+     *     Merges two sorted sets into the operand.
+     * @details
+     *     Both sets are traversed once in order.  Elements found only in the
+     *     base set, in both sets or only in the relative set are
+     *     incorporated into the operand according to the former, common and
+     *     latter template arguments respectively.
+     */
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator,
+        const bool Former,
+        const bool Common,
+        const bool Latter>
+    static inline bool
+    Interweave(
+        Referential<Arboreal<Natural, Breadth, Elemental>>
+            operand,
+        Referential<const Axial<const Basic, BasicPositional, BasicNatural, const Elemental>>
+            basis,
+        Referential<const Basic>
+            base_set,
+        Referential<const Axial<const Relative, RelativePositional, RelativeNatural, const Elemental>>
+            relativity,
+        Referential<const Relative>
+            relative_set)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<BasicNatural>::value && is_unsigned<BasicNatural>::value,
+            "BasicNatural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using ElementReferential = Referential<const Elemental>;
+        static auto& IncorporateElement = Incorporate<Natural, Breadth, Elemental, Equate, Order, Allocator>;
+        BasicPositional position;
+        RelativePositional apposition;
+        bool base_remains, relative_remains;
+        Fell<Natural, Breadth, Elemental, Allocator>(operand);
+        base_remains = basis.increment.begins(base_set, 0);
+        relative_remains = relativity.increment.begins(relative_set, 0);
+        if (base_remains)
+            basis.increment.scale.begin(base_set, position, 0);
+        if (relative_remains)
+            relativity.increment.scale.begin(relative_set, apposition, 0);
+        while (base_remains && relative_remains) {
+            ElementReferential
+                base_value
+                = basis.increment.scale.go(base_set, position).to,
+                relative_value = relativity.increment.scale.go(relative_set, apposition).to;
+            const bool
+                precedes
+                = Order(base_value, relative_value),
+                succeeds = !precedes && !Equate(base_value, relative_value);
+            if (precedes) {
+                if (Former && !IncorporateElement(operand, base_value))
+                    return false;
+            } else if (succeeds) {
+                if (Latter && !IncorporateElement(operand, relative_value))
+                    return false;
+            } else if (Common && !IncorporateElement(operand, base_value)) {
+                return false;
+            }
+            if (!succeeds) {
+                base_remains = basis.increment.traverses(base_set, position, 1);
+                if (base_remains)
+                    basis.increment.scale.traverse(base_set, position, 1);
+            }
+            if (!precedes) {
+                relative_remains = relativity.increment.traverses(relative_set, apposition, 1);
+                if (relative_remains)
+                    relativity.increment.scale.traverse(relative_set, apposition, 1);
+            }
+        }
+        while (Former && base_remains) {
+            if (!IncorporateElement(operand, basis.increment.scale.go(base_set, position).to))
+                return false;
+            base_remains = basis.increment.traverses(base_set, position, 1);
+            if (base_remains)
+                basis.increment.scale.traverse(base_set, position, 1);
+        }
+        while (Latter && relative_remains) {
+            if (!IncorporateElement(operand, relativity.increment.scale.go(relative_set, apposition).to))
+                return false;
+            relative_remains = relativity.increment.traverses(relative_set, apposition, 1);
+            if (relative_remains)
+                relativity.increment.scale.traverse(relative_set, apposition, 1);
+        }
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    constexpr Compositional<Arboreal<Natural, Breadth, Elemental>, Natural, Elemental>
+        OrderedComposer = {
+            Prepare<Natural, Breadth, Elemental>,
+            AccreditCollection<Natural, Breadth, Elemental, Equate, Order>,
+            ComposeCollection<Natural, Breadth, Elemental, Equate, Order, Allocator>,
+            RecomposeCollection<Natural, Breadth, Elemental, Equate, Order, Allocator>,
+            DiscomposeCollection<Natural, Breadth, Elemental, Equate, Order, Allocator>,
+            Fell<Natural, Breadth, Elemental, Allocator>,
+            Dispose<Natural, Breadth, Elemental>
+        };
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    constexpr Sectional<Arboreal<Natural, Breadth, Elemental>, Basic, BasicPositional, BasicNatural, Relative, RelativePositional, RelativeNatural, Elemental>
+        OrderedSection = {
+            ComplementSelections<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            DifferentiateSelections<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            IntersectSelections<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            UniteSelections<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    constexpr Selective<Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, Elemental>
+        OrderedSelector = {
+            OrderedComposer<Natural, Breadth, Elemental, Equate, Order, Allocator>,
+            OrderedSection<
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            CollateSelection<
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            EquateSelections<
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Elemental,
+                Equate>,
+            Account<Natural, Breadth, Elemental>
+        };
+
+    template <
+        typename Basic,
+        typename BasicPositional,
+        typename BasicNatural,
+        typename Relative,
+        typename RelativePositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    constexpr Bisectional<Arboreal<Natural, Breadth, Elemental>, Basic, BasicPositional, BasicNatural, Relative, RelativePositional, RelativeNatural, Elemental>
+        Bisection = {
+            Interweave<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator,
+                false,
+                false,
+                true>,
+            Interweave<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator,
+                true,
+                false,
+                true>,
+            Interweave<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator,
+                false,
+                true,
+                false>,
+            Interweave<
+                Basic,
+                BasicPositional,
+                BasicNatural,
+                Relative,
+                RelativePositional,
+                RelativeNatural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator,
+                true,
+                true,
+                true>
+        };
+
+    template <
+        typename Natural,
+        Natural Breadth,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DefaultAllocative<Ramal<Natural, Breadth, Elemental>>> Allocator>
+    constexpr Collective<Arboreal<Natural, Breadth, Elemental>, Foliar<Natural, Breadth, Elemental>, Natural, Elemental>
+        Collector = {
+            OrderedSelector<Natural, Breadth, Elemental, Equate, Order, Allocator>,
+            Bisection<
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            CollateCollection<
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Natural,
+                Breadth,
+                Elemental,
+                Equate,
+                Order,
+                Allocator>,
+            EquateCollections<
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Arboreal<Natural, Breadth, Elemental>,
+                Foliar<Natural, Breadth, Elemental>,
+                Natural,
+                Elemental,
+                Equate>
+        };
+
+}
+
+}
+
+#endif
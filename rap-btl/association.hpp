@@ -15,6 +15,7 @@
  */
 namespace association {
 
+using ::location::Deferential;
 using ::location::Referential;
 
 /**
@@ -126,6 +127,41 @@ struct Associative {
                    */
 };
 
+/**
+ * @brief
+ *     Associative mapping move classifier.
+ * @details
+ *     This type is used alongside an associative mapping classifier to add
+ *     mappings whose relator and value are moved into the space by rvalue
+ *     reference rather than copied.  Deferrers are provided for the ordered
+ *     associative collections of the ration and junction modules only.
+ * @tparam Consolidative
+ *     Type of the space which contains the mappings.
+ * @tparam Correlative
+ *     Type of the relators (keys).
+ * @tparam Evaluative
+ *     Type of the values.
+ */
+template <
+    typename Consolidative,
+    typename Correlative,
+    typename Evaluative>
+struct Deferrable {
+
+    Referential<bool(
+        Referential<Consolidative>
+            operand,
+        Deferential<Correlative>
+            relator,
+        Deferential<Evaluative>
+            value)>
+        associate; /**< Function reference which moves a mapping into the
+                    *   space.  False should be returned if the relator 
+                    *   already exists in the space without affecting the
+                    *   space.
+                    */
+};
+
 /**
  * @brief 
  *     Facilitates pairing a relator (key) and value.
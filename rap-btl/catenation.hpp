@@ -0,0 +1,1264 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef CATENATION_MODULE
+#define CATENATION_MODULE
+#include <trajection.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+/**
+ * @brief
+ *     Index linked list management and trajection implementation.
+ * @details
+ *     Linked list management and trajection implementation where the nodes
+ *     of a list are kept in a contiguous array within the list itself and
+ *     are linked by index rather than by pointer.  With 16 or 32 bit
+ *     unsigned integers the links are a half or a quarter of the size of
+ *     pointer links on 64 bit platforms, and since no link refers to an
+ *     address, lists may be copied, relocated or serialized as plain data.
+ *     Index zero denotes the absence of a node, so the node at index i is
+ *     the array element at offset i - 1.
+ */
+namespace catenation {
+
+using ::comparison::Comparative;
+using ::comparison::Equative;
+using ::comparison::Relational;
+using ::location::Conferential;
+using ::location::Locational;
+using ::location::Referential;
+using ::trajection::Axial;
+using ::trajection::Directional;
+using ::trajection::Lineal;
+using ::trajection::Scalar;
+using ::trajection::Vectorial;
+
+/**
+ * @brief
+ *     Single index link conformity.
+ * @details
+ *     This type is used to represent a singly connective list node link.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ */
+template <typename Natural>
+struct SinglyCatenated {
+
+    Natural
+        next; /**< Index of the next node. */
+};
+
+/**
+ * @brief
+ *     Double index link conformity.
+ * @details
+ *     This type is used to represent a doubly connective list node link.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ */
+template <typename Natural>
+struct DoublyCatenated {
+
+    Natural
+        previous, /**< Index of the previous node. */
+        next; /**< Index of the next node. */
+};
+
+/**
+ * @brief
+ *     Index linked list node conformity.
+ * @details
+ *     This type is used to represent an index linked list node.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Elemental>
+struct Catenal {
+
+    Connective
+        link; /**< Node link(s) substructure. */
+
+    Elemental
+        element; /**< Instance of the element at this node. */
+};
+
+/**
+ * @brief
+ *     Singly index linked node conformity.
+ * @details
+ *     This type alias is used to represent a singly index linked list node.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+using SinglyCatenal = Catenal<SinglyCatenated<Natural>, Elemental>;
+
+/**
+ * @brief
+ *     Doubly index linked node conformity.
+ * @details
+ *     This type alias is used to represent a doubly index linked list node.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+using DoublyCatenal = Catenal<DoublyCatenated<Natural>, Elemental>;
+
+/**
+ * @brief
+ *     Index linked list conformity.
+ * @details
+ *     This type is used to represent an index linked list together with
+ *     the array of nodes it links.  Nodes at indices above the total have
+ *     never been used, while used nodes which are not in the active list
+ *     are kept in the unused sublist.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index and count.
+ * @tparam Maximum
+ *     The maximum number of nodes and size of the array.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+struct Catenary {
+
+    Natural
+        first, /**< Index of the first node in the list. */
+        last, /**< Index of the last node in the list. */
+        unused, /**< Index of the first node in the unused sublist. */
+        count, /**< Number of nodes in the active list. */
+        total; /**< Number of nodes which have ever been used. */
+
+    Catenal<Connective, Elemental>
+        source[Maximum]; /**< Array of nodes. */
+};
+
+/**
+ * @brief
+ *     Singly index linked list conformity.
+ * @details
+ *     This type alias is used to represent a singly index linked list.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index and count.
+ * @tparam Maximum
+ *     The maximum number of nodes and size of the array.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+using SinglyCatenary = Catenary<SinglyCatenated<Natural>, Natural, Maximum, Elemental>;
+
+/**
+ * @brief
+ *     Doubly index linked list conformity.
+ * @details
+ *     This type alias is used to represent a doubly index linked list.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index and count.
+ * @tparam Maximum
+ *     The maximum number of nodes and size of the array.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+using DoublyCatenary = Catenary<DoublyCatenated<Natural>, Natural, Maximum, Elemental>;
+
+/**
+ * @brief
+ *     Index linked list position conformity.
+ * @details
+ *     This type is used to represent a position in an index linked list.
+ *     The position records the node array it was taken from so positions
+ *     can be compared without the list.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+struct Catenative {
+
+    Locational<const Catenal<Connective, Elemental>>
+        source; /**< Array of nodes of the list. */
+
+    Natural
+        at; /**< Index of the node. */
+};
+
+/**
+ * @brief
+ *     Singly index linked list position conformity.
+ * @details
+ *     This type alias is used to represent a position in a singly index
+ *     linked list.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+using SinglyCatenative = Catenative<SinglyCatenated<Natural>, Natural, Elemental>;
+
+/**
+ * @brief
+ *     Doubly index linked list position conformity.
+ * @details
+ *     This type alias is used to represent a position in a doubly index
+ *     linked list.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+using DoublyCatenative = Catenative<DoublyCatenated<Natural>, Natural, Elemental>;
+
+/**
+ * @brief
+ *     Function abstract used to get a polar position in the list.
+ * @details
+ *     This function type alias is used to declare function references which
+ *     return the index of either the first or last node in the list.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Maximum
+ *     The maximum number of nodes.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+using Original = Natural(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list);
+
+/**
+ * @brief
+ *     Function abstract used to get a node subsequent to another node.
+ * @details
+ *     This function type alias is used to declare function references which
+ *     return the index of either the next or previous node in the list.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Natural
+ *     Type of unsigned integer used as node index.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+using Subsequent = Natural(
+    const Locational<const Catenal<Connective, Elemental>>
+        source,
+    const Natural
+        node);
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Catenary<Connective, Natural, Maximum, Elemental>
+    InitializedCatenary = { 0, 0, 0, 0, 0 };
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline Natural
+GetNext(
+    const Locational<const Catenal<Connective, Elemental>>
+        source,
+    const Natural
+        node)
+{
+    return source[node - 1].link.next;
+}
+
+template <
+    typename Natural,
+    typename Elemental>
+static inline Natural
+GetPrevious(
+    const Locational<const DoublyCatenal<Natural, Elemental>>
+        source,
+    const Natural
+        node)
+{
+    return source[node - 1].link.previous;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline void
+SetNext(
+    const Locational<Catenal<Connective, Elemental>>
+        source,
+    const Natural
+        node,
+    const Natural
+        next)
+{
+    source[node - 1].link.next = next;
+}
+
+template <
+    typename Natural,
+    typename Elemental>
+static inline void
+SetPrevious(
+    const Locational<DoublyCatenal<Natural, Elemental>>
+        source,
+    const Natural
+        node,
+    const Natural
+        previous)
+{
+    source[node - 1].link.previous = previous;
+}
+
+template <
+    typename Natural,
+    typename Elemental>
+static inline void
+ConnectNext(
+    const Locational<SinglyCatenal<Natural, Elemental>>
+        source,
+    const Natural
+        first,
+    const Natural
+        second)
+{
+    SetNext(source, first, second);
+}
+
+template <
+    typename Natural,
+    typename Elemental>
+static inline void
+ConnectNext(
+    const Locational<DoublyCatenal<Natural, Elemental>>
+        source,
+    const Natural
+        first,
+    const Natural
+        second)
+{
+    SetNext(source, first, second);
+    if (second)
+        SetPrevious(source, second, first);
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Natural
+GetFirst(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return list.first;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Natural
+GetLast(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return list.last;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Natural
+Account(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return list.count;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline Natural
+Count(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current, count;
+    count = 0;
+    current = GetSubsequent(list.source, position.at);
+    while (current) {
+        count++;
+        current = GetSubsequent(list.source, current);
+    }
+    return count;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline bool
+IsEqual(
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        base,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        relative)
+{
+    return base.at == relative.at;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline bool
+IsNotEqual(
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        base,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        relative)
+{
+    return base.at != relative.at;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline bool
+IsLesser(
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        base,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        relative)
+{
+    Natural current;
+    current = GetNext(base.source, base.at);
+    while (current) {
+        if (current == relative.at)
+            return true;
+        current = GetNext(base.source, current);
+    }
+    return false;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline bool
+IsGreater(
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        base,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        relative)
+{
+    return IsLesser(relative, base);
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline bool
+IsNotGreater(
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        base,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        relative)
+{
+    return base.at == relative.at || IsLesser(base, relative);
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+static inline bool
+IsNotLesser(
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        base,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        relative)
+{
+    return base.at == relative.at || IsLesser(relative, base);
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+Initialize(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    list.first = list.last = list.unused = list.count = list.total = 0;
+    return list;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline bool
+RemoveAll(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    bool actioned = false;
+    if (list.last) {
+        SetNext(list.source, list.last, list.unused);
+        list.unused = list.first;
+        actioned = true;
+    }
+    list.first = list.last = 0;
+    list.count = 0;
+    return actioned;
+}
+
+// Takes the first node of the unused sublist, or the first node which has
+// never been used if the unused sublist is empty.  Returns zero if every
+// node of the array is in the active list.
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Natural
+Reclaim(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural result;
+    result = list.unused;
+    if (result)
+        list.unused = GetNext<Connective, Natural, Elemental>(list.source, result);
+    else if (list.total < Maximum)
+        result = ++list.total;
+    return result;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Natural
+Proclaim(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Elemental>
+        value)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural result;
+    result = Reclaim(list);
+    if (result)
+        list.source[result - 1].element = value;
+    return result;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline bool
+Instantiate(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return Maximum - list.count >= count;
+}
+
+// The nodes are part of the list, so there is never any node memory to
+// free.
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline bool
+DeleteNothing(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return false;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline bool
+Contains(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        position)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current;
+    if (position.source != list.source)
+        return false;
+    current = list.first;
+    while (current) {
+        if (current == position.at)
+            return true;
+        current = GetNext<Connective, Natural, Elemental>(list.source, current);
+    }
+    return false;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Conferential<const Elemental>
+GoRead(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        position)
+{
+    using ::location::Confer;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    static auto& ConferElement = Confer<const Elemental>;
+    return ConferElement(list.source[position.at - 1].element);
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+static inline Conferential<Elemental>
+GoWrite(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        position)
+{
+    using ::location::Confer;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    static auto& ConferElement = Confer<Elemental>;
+    return ConferElement(list.source[position.at - 1].element);
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Original<Connective, Natural, Maximum, Elemental>> GetOrigin,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline Referential<const Catenative<Connective, Natural, Elemental>>
+BeginReadScale(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<Catenative<Connective, Natural, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current, index;
+    current = GetOrigin(list);
+    for (index = 0; index < count; index++)
+        current = GetSubsequent(list.source, current);
+    position.source = list.source;
+    position.at = current;
+    return position;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Original<Connective, Natural, Maximum, Elemental>> GetOrigin,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline Referential<const Catenative<Connective, Natural, Elemental>>
+BeginWriteScale(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<Catenative<Connective, Natural, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current, index;
+    current = GetOrigin(list);
+    for (index = 0; index < count; index++)
+        current = GetSubsequent(list.source, current);
+    position.source = list.source;
+    position.at = current;
+    return position;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Original<Connective, Natural, Maximum, Elemental>> GetOrigin,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline bool
+DirectionBegins(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return count < list.count;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline Referential<const Catenative<Connective, Natural, Elemental>>
+TraverseReadScale(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<Catenative<Connective, Natural, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current, index;
+    current = position.at;
+    for (index = 0; index < count; index++)
+        current = GetSubsequent(list.source, current);
+    position.at = current;
+    return position;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline Referential<const Catenative<Connective, Natural, Elemental>>
+TraverseWriteScale(
+    Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<Catenative<Connective, Natural, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current, index;
+    current = position.at;
+    for (index = 0; index < count; index++)
+        current = GetSubsequent(list.source, current);
+    position.at = current;
+    return position;
+}
+
+template <
+    typename Connective,
+    typename Natural,
+    Natural Maximum,
+    typename Elemental,
+    Referential<Subsequent<Connective, Natural, Elemental>> GetSubsequent>
+static inline bool
+DirectionTraverses(
+    Referential<const Catenary<Connective, Natural, Maximum, Elemental>>
+        list,
+    Referential<const Catenative<Connective, Natural, Elemental>>
+        position,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural current, index;
+    current = position.at;
+    for (index = 0; index < count; index++) {
+        current = GetSubsequent(list.source, current);
+        if (!current)
+            return false;
+    }
+    return true;
+}
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr Equative<SinglyCatenative<Natural, Elemental>>
+    SingleEquality = {
+        IsEqual<SinglyCatenated<Natural>, Natural, Elemental>,
+        IsNotEqual<SinglyCatenated<Natural>, Natural, Elemental>
+    };
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr Equative<DoublyCatenative<Natural, Elemental>>
+    DoubleEquality = {
+        IsEqual<DoublyCatenated<Natural>, Natural, Elemental>,
+        IsNotEqual<DoublyCatenated<Natural>, Natural, Elemental>
+    };
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr Relational<SinglyCatenative<Natural, Elemental>>
+    SingleRelation = {
+        IsLesser<SinglyCatenated<Natural>, Natural, Elemental>,
+        IsGreater<SinglyCatenated<Natural>, Natural, Elemental>,
+        IsNotGreater<SinglyCatenated<Natural>, Natural, Elemental>,
+        IsNotLesser<SinglyCatenated<Natural>, Natural, Elemental>
+    };
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr Relational<DoublyCatenative<Natural, Elemental>>
+    DoubleRelation = {
+        IsLesser<DoublyCatenated<Natural>, Natural, Elemental>,
+        IsGreater<DoublyCatenated<Natural>, Natural, Elemental>,
+        IsNotGreater<DoublyCatenated<Natural>, Natural, Elemental>,
+        IsNotLesser<DoublyCatenated<Natural>, Natural, Elemental>
+    };
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr Comparative<SinglyCatenative<Natural, Elemental>>
+    SingleComparison = {
+        SingleEquality<Natural, Elemental>,
+        SingleRelation<Natural, Elemental>
+    };
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr Comparative<DoublyCatenative<Natural, Elemental>>
+    DoubleComparison = {
+        DoubleEquality<Natural, Elemental>,
+        DoubleRelation<Natural, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Vectorial<const SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, const Elemental>
+    ReadSingleVector = {
+        SingleComparison<Natural, Elemental>,
+        Contains<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+        GoRead<SinglyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Vectorial<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, const Elemental>
+    ReadDoubleVector = {
+        DoubleComparison<Natural, Elemental>,
+        Contains<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        GoRead<DoublyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Vectorial<SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Elemental>
+    WriteSingleVector = {
+        SingleComparison<Natural, Elemental>,
+        Contains<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+        GoWrite<SinglyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Vectorial<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Elemental>
+    WriteDoubleVector = {
+        DoubleComparison<Natural, Elemental>,
+        Contains<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        GoWrite<DoublyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Scalar<const SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadIncrementSingleScale = {
+        SingleComparison<Natural, Elemental>,
+        BeginReadScale<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<SinglyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        TraverseReadScale<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        GoRead<SinglyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Scalar<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadIncrementDoubleScale = {
+        DoubleComparison<Natural, Elemental>,
+        BeginReadScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        TraverseReadScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        GoRead<DoublyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Scalar<SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteIncrementSingleScale = {
+        SingleComparison<Natural, Elemental>,
+        BeginWriteScale<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<SinglyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        TraverseWriteScale<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        GoWrite<SinglyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Scalar<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteIncrementDoubleScale = {
+        DoubleComparison<Natural, Elemental>,
+        BeginWriteScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        TraverseWriteScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        GoWrite<DoublyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Scalar<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadDecrementDoubleScale = {
+        DoubleComparison<Natural, Elemental>,
+        BeginReadScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetLast<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetPrevious<Natural, Elemental>>,
+        TraverseReadScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetPrevious<Natural, Elemental>>,
+        GoRead<DoublyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Scalar<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteDecrementDoubleScale = {
+        DoubleComparison<Natural, Elemental>,
+        BeginWriteScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetLast<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetPrevious<Natural, Elemental>>,
+        TraverseWriteScale<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetPrevious<Natural, Elemental>>,
+        GoWrite<DoublyCatenated<Natural>, Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Lineal<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadDoubleLiner = {
+        ReadIncrementDoubleScale<Natural, Maximum, Elemental>,
+        ReadDecrementDoubleScale<Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Lineal<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteDoubleLiner = {
+        WriteIncrementDoubleScale<Natural, Maximum, Elemental>,
+        WriteDecrementDoubleScale<Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Directional<const SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadIncrementSingleDirection = {
+        ReadIncrementSingleScale<Natural, Maximum, Elemental>,
+        DirectionBegins<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<SinglyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        DirectionTraverses<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        Contains<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Account<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Count<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Directional<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadIncrementDoubleDirection = {
+        ReadIncrementDoubleScale<Natural, Maximum, Elemental>,
+        DirectionBegins<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        DirectionTraverses<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        Contains<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Account<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Count<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Directional<SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteIncrementSingleDirection = {
+        WriteIncrementSingleScale<Natural, Maximum, Elemental>,
+        DirectionBegins<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<SinglyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        DirectionTraverses<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>,
+        Contains<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Account<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Count<SinglyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<SinglyCatenated<Natural>, Natural, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Directional<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteIncrementDoubleDirection = {
+        WriteIncrementDoubleScale<Natural, Maximum, Elemental>,
+        DirectionBegins<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetFirst<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        DirectionTraverses<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>,
+        Contains<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Account<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Count<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetNext<DoublyCatenated<Natural>, Natural, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Directional<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadDecrementDoubleDirection = {
+        ReadDecrementDoubleScale<Natural, Maximum, Elemental>,
+        DirectionBegins<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetLast<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetPrevious<Natural, Elemental>>,
+        DirectionTraverses<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetPrevious<Natural, Elemental>>,
+        Contains<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Account<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Count<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetPrevious<Natural, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Directional<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteDecrementDoubleDirection = {
+        WriteDecrementDoubleScale<Natural, Maximum, Elemental>,
+        DirectionBegins<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetLast<DoublyCatenated<Natural>, Natural, Maximum, Elemental>, GetPrevious<Natural, Elemental>>,
+        DirectionTraverses<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetPrevious<Natural, Elemental>>,
+        Contains<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Account<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+        Count<DoublyCatenated<Natural>, Natural, Maximum, Elemental, GetPrevious<Natural, Elemental>>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Axial<const DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, const Elemental>
+    ReadDoubleAxis = {
+        ReadIncrementDoubleDirection<Natural, Maximum, Elemental>,
+        ReadDecrementDoubleDirection<Natural, Maximum, Elemental>
+    };
+
+template <
+    typename Natural,
+    Natural Maximum,
+    typename Elemental>
+constexpr Axial<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+    WriteDoubleAxis = {
+        WriteIncrementDoubleDirection<Natural, Maximum, Elemental>,
+        WriteDecrementDoubleDirection<Natural, Maximum, Elemental>
+    };
+
+}
+
+#endif
@@ -0,0 +1,1088 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef CATENATION_CONSECUTION_MODULE
+#define CATENATION_CONSECUTION_MODULE
+#include <catenation.hpp>
+#include <consecution.hpp>
+
+namespace catenation {
+
+/**
+ * @brief         
+ *     Index linked list sequence management implementation.
+ * @details       
+ *     Index linked list sequence management implementation.  Nodes released
+ *     from the active list are kept in the unused sublist of the same list
+ *     and are reused before any node which has never been used, so a list
+ *     never holds more than its maximum number of nodes.
+ */
+namespace consecution {
+
+    using ::consecution::Conjoint;
+    using ::consecution::Sequent;
+
+    // It is the responsibility of the calling function to terminate or
+    // attach each directional end of the resulting sequence of nodes
+    // (before head and after tail where applicable).
+    template <
+        typename Connective,
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Sequence(
+        Referential<Catenary<Connective, Natural, Maximum, Elemental>>
+            sequence,
+        Referential<Natural>
+            head,
+        Referential<Natural>
+            tail,
+        Referential<Natural>
+            length,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using CountReferential = Referential<const Natural>;
+        auto finalize = [&](CountReferential start, CountReferential finish, CountReferential counted) -> bool {
+            head = start;
+            tail = finish;
+            length = counted;
+            return length > 0;
+        };
+        Appositional current;
+        Natural first, last, next, count;
+        current = from;
+        first = Proclaim(sequence, direction.scale.go(space, current).to);
+        if (!first)
+            return finalize(0, 0, 0);
+        last = first;
+        count = 1;
+        while (direction.scale.order.equality.is_not_equal(current, to)) {
+            if (Safety && !direction.traverses(space, current, 1)) {
+                SetNext(sequence.source, last, sequence.unused);
+                sequence.unused = first;
+                return finalize(0, 0, 0);
+            }
+            direction.scale.traverse(space, current, 1);
+            next = Proclaim(sequence, direction.scale.go(space, current).to);
+            if (!next) {
+                SetNext(sequence.source, last, sequence.unused);
+                sequence.unused = first;
+                return finalize(0, 0, 0);
+            }
+            ConnectNext(sequence.source, last, next);
+            last = next;
+            count++;
+        }
+        return finalize(first, last, count);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Accede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        SetNext(sequence.source, result, sequence.first);
+        if (!sequence.first)
+            sequence.last = result;
+        sequence.first = result;
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Accede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        SetPrevious(sequence.source, result, Natural(0));
+        ConnectNext(sequence.source, result, sequence.first);
+        if (!sequence.first)
+            sequence.last = result;
+        sequence.first = result;
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<SinglyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>;
+        Natural first, last, length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetNext(sequence.source, last, sequence.first);
+        if (!sequence.first)
+            sequence.last = last;
+        sequence.first = first;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<DoublyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>;
+        Natural first, last, length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetPrevious(sequence.source, first, Natural(0));
+        ConnectNext(sequence.source, last, sequence.first);
+        if (!sequence.first)
+            sequence.last = last;
+        sequence.first = first;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Precede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const SinglyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result, previous;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        previous = sequence.first;
+        if (previous == rank.at) {
+            sequence.first = result;
+        } else {
+            while (GetNext(sequence.source, previous) != rank.at)
+                previous = GetNext(sequence.source, previous);
+            SetNext(sequence.source, previous, result);
+        }
+        SetNext(sequence.source, result, rank.at);
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Precede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const DoublyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result, previous;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        previous = GetPrevious(sequence.source, rank.at);
+        if (previous)
+            SetNext(sequence.source, previous, result);
+        else
+            sequence.first = result;
+        SetPrevious(sequence.source, result, previous);
+        ConnectNext(sequence.source, result, rank.at);
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Precede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const SinglyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<SinglyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>;
+        Natural first, last, length, previous;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        previous = sequence.first;
+        if (previous == rank.at) {
+            sequence.first = first;
+        } else {
+            while (GetNext(sequence.source, previous) != rank.at)
+                previous = GetNext(sequence.source, previous);
+            SetNext(sequence.source, previous, first);
+        }
+        SetNext(sequence.source, last, rank.at);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Precede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const DoublyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<DoublyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>;
+        Natural first, last, length, previous;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        previous = GetPrevious(sequence.source, rank.at);
+        if (previous)
+            SetNext(sequence.source, previous, first);
+        else
+            sequence.first = first;
+        SetPrevious(sequence.source, first, previous);
+        ConnectNext(sequence.source, last, rank.at);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Cede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const SinglyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        SetNext(sequence.source, result, GetNext(sequence.source, rank.at));
+        SetNext(sequence.source, rank.at, result);
+        if (!GetNext(sequence.source, result))
+            sequence.last = result;
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Cede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const DoublyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        ConnectNext(sequence.source, result, GetNext(sequence.source, rank.at));
+        ConnectNext(sequence.source, rank.at, result);
+        if (!GetNext(sequence.source, result))
+            sequence.last = result;
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Cede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const SinglyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<SinglyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>;
+        Natural first, last, length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetNext(sequence.source, last, GetNext(sequence.source, rank.at));
+        if (!GetNext(sequence.source, last))
+            sequence.last = last;
+        SetNext(sequence.source, rank.at, first);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Cede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const DoublyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<DoublyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>;
+        Natural first, last, length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        ConnectNext(sequence.source, last, GetNext(sequence.source, rank.at));
+        if (!GetNext(sequence.source, last))
+            sequence.last = last;
+        ConnectNext(sequence.source, rank.at, first);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Proceed(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        SetNext(sequence.source, result, Natural(0));
+        if (sequence.last)
+            SetNext(sequence.source, sequence.last, result);
+        else
+            sequence.first = result;
+        sequence.last = result;
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Proceed(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural result;
+        result = Proclaim(sequence, value);
+        if (!result)
+            return false;
+        SetPrevious(sequence.source, result, sequence.last);
+        SetNext(sequence.source, result, Natural(0));
+        if (sequence.last)
+            SetNext(sequence.source, sequence.last, result);
+        else
+            sequence.first = result;
+        sequence.last = result;
+        sequence.count++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<SinglyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>;
+        Natural first, last, length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetNext(sequence.source, last, Natural(0));
+        if (sequence.last)
+            SetNext(sequence.source, sequence.last, first);
+        else
+            sequence.first = first;
+        sequence.last = last;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static auto& SequenceList = Sequence<DoublyCatenated<Natural>, Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>;
+        Natural first, last, length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetNext(sequence.source, last, Natural(0));
+        SetPrevious(sequence.source, first, sequence.last);
+        if (sequence.last)
+            SetNext(sequence.source, sequence.last, first);
+        else
+            sequence.first = first;
+        sequence.last = last;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Succeed(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural first, last, index;
+        if (count <= 0)
+            return false;
+        first = last = sequence.first;
+        for (index = 1; index < count; index++)
+            last = GetNext(sequence.source, last);
+        sequence.first = GetNext(sequence.source, last);
+        if (!sequence.first)
+            sequence.last = 0;
+        SetNext(sequence.source, last, sequence.unused);
+        sequence.unused = first;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Succeed(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural first, last, index;
+        if (count <= 0)
+            return false;
+        first = last = sequence.first;
+        for (index = 1; index < count; index++)
+            last = GetNext(sequence.source, last);
+        sequence.first = GetNext(sequence.source, last);
+        if (sequence.first)
+            SetPrevious(sequence.source, sequence.first, Natural(0));
+        else
+            sequence.last = 0;
+        SetNext(sequence.source, last, sequence.unused);
+        sequence.unused = first;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Supersede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const SinglyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural first, last, previous, index;
+        if (count <= 0)
+            return false;
+        previous = last = sequence.first;
+        for (index = 1; index < count; index++)
+            last = GetNext(sequence.source, last);
+        if (last == rank.at) {
+            sequence.first = GetNext(sequence.source, rank.at);
+            if (!sequence.first)
+                sequence.last = 0;
+            SetNext(sequence.source, rank.at, sequence.unused);
+            sequence.unused = previous;
+        } else {
+            while (GetNext(sequence.source, last) != rank.at) {
+                previous = GetNext(sequence.source, previous);
+                last = GetNext(sequence.source, last);
+            }
+            first = GetNext(sequence.source, previous);
+            SetNext(sequence.source, previous, GetNext(sequence.source, rank.at));
+            if (!GetNext(sequence.source, previous))
+                sequence.last = previous;
+            SetNext(sequence.source, rank.at, sequence.unused);
+            sequence.unused = first;
+        }
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Supersede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const DoublyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural first, previous, next, index;
+        if (count <= 0)
+            return false;
+        first = rank.at;
+        for (index = 1; index < count; index++)
+            first = GetPrevious(sequence.source, first);
+        previous = GetPrevious(sequence.source, first);
+        next = GetNext(sequence.source, rank.at);
+        if (previous)
+            SetNext(sequence.source, previous, next);
+        else
+            sequence.first = next;
+        if (next)
+            SetPrevious(sequence.source, next, previous);
+        else
+            sequence.last = previous;
+        SetNext(sequence.source, rank.at, sequence.unused);
+        sequence.unused = first;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Concede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const SinglyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural last, previous, index;
+        if (count <= 0)
+            return false;
+        last = rank.at;
+        for (index = 1; index < count; index++)
+            last = GetNext(sequence.source, last);
+        if (rank.at == sequence.first) {
+            previous = 0;
+            sequence.first = GetNext(sequence.source, last);
+        } else {
+            previous = sequence.first;
+            while (GetNext(sequence.source, previous) != rank.at)
+                previous = GetNext(sequence.source, previous);
+            SetNext(sequence.source, previous, GetNext(sequence.source, last));
+        }
+        if (!GetNext(sequence.source, last))
+            sequence.last = previous;
+        SetNext(sequence.source, last, sequence.unused);
+        sequence.unused = rank.at;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Concede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const DoublyCatenative<Natural, Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural last, previous, next, index;
+        if (count <= 0)
+            return false;
+        last = rank.at;
+        for (index = 1; index < count; index++)
+            last = GetNext(sequence.source, last);
+        previous = GetPrevious(sequence.source, rank.at);
+        next = GetNext(sequence.source, last);
+        if (previous)
+            SetNext(sequence.source, previous, next);
+        else
+            sequence.first = next;
+        if (next)
+            SetPrevious(sequence.source, next, previous);
+        else
+            sequence.last = previous;
+        SetNext(sequence.source, last, sequence.unused);
+        sequence.unused = rank.at;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Recede(
+        Referential<SinglyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural previous, index, offset;
+        if (count <= 0)
+            return false;
+        if (count == sequence.count)
+            return RemoveAll(sequence);
+        offset = sequence.count - count;
+        previous = sequence.first;
+        for (index = 1; index < offset; index++)
+            previous = GetNext(sequence.source, previous);
+        SetNext(sequence.source, sequence.last, sequence.unused);
+        sequence.unused = GetNext(sequence.source, previous);
+        SetNext(sequence.source, previous, Natural(0));
+        sequence.last = previous;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Recede(
+        Referential<DoublyCatenary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural first, last, index;
+        if (count <= 0)
+            return false;
+        first = last = sequence.last;
+        for (index = 1; index < count; index++)
+            first = GetPrevious(sequence.source, first);
+        sequence.last = GetPrevious(sequence.source, first);
+        if (sequence.last)
+            SetNext(sequence.source, sequence.last, Natural(0));
+        else
+            sequence.first = 0;
+        SetNext(sequence.source, last, sequence.unused);
+        sequence.unused = first;
+        sequence.count -= count;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Conjoint<SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Relative, Appositional, RelativeNatural, Elemental>
+        SingleConjoiner = {
+            Accede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>,
+            Precede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental>,
+            Cede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental>,
+            Proceed<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>
+        };
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Conjoint<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Relative, Appositional, RelativeNatural, Elemental>
+        DoubleConjoiner = {
+            Accede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>,
+            Precede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental>,
+            Cede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental>,
+            Proceed<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Sequent<SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Natural, Elemental>
+        SingleSequencer = {
+            Instantiate<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+            Account<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+            Accede<Natural, Maximum, Elemental>,
+            Precede<Natural, Maximum, Elemental>,
+            Cede<Natural, Maximum, Elemental>,
+            Proceed<Natural, Maximum, Elemental>,
+            Succeed<Natural, Maximum, Elemental>,
+            Supersede<Natural, Maximum, Elemental>,
+            Concede<Natural, Maximum, Elemental>,
+            Recede<Natural, Maximum, Elemental>,
+            RemoveAll<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+            DeleteNothing<SinglyCatenated<Natural>, Natural, Maximum, Elemental>,
+            SingleConjoiner<SinglyCatenary<Natural, Maximum, Elemental>, SinglyCatenative<Natural, Elemental>, Natural, Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Sequent<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Elemental>
+        DoubleSequencer = {
+            Instantiate<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+            Account<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+            Accede<Natural, Maximum, Elemental>,
+            Precede<Natural, Maximum, Elemental>,
+            Cede<Natural, Maximum, Elemental>,
+            Proceed<Natural, Maximum, Elemental>,
+            Succeed<Natural, Maximum, Elemental>,
+            Supersede<Natural, Maximum, Elemental>,
+            Concede<Natural, Maximum, Elemental>,
+            Recede<Natural, Maximum, Elemental>,
+            RemoveAll<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+            DeleteNothing<DoublyCatenated<Natural>, Natural, Maximum, Elemental>,
+            DoubleConjoiner<DoublyCatenary<Natural, Maximum, Elemental>, DoublyCatenative<Natural, Elemental>, Natural, Natural, Maximum, Elemental>
+        };
+
+}
+
+}
+
+#endif
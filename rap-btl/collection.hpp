@@ -8,15 +8,18 @@
  * @brief
  *     Sorted set management.
  * @details
- *     Sorted set management abstracts, classifiers and sorted set equality
- *     comparison function.
+ *     Sorted set management abstracts, classifiers, sorted set equality
+ *     comparison function and multiple sorted set merge functions.
  */
 namespace collection {
 
+using ::location::Locational;
 using ::location::Referential;
 using ::selection::Equipollent;
 using ::selection::Selective;
 using ::sortation::Assortive;
+using ::sortation::BeginTournament;
+using ::sortation::ReplayTournament;
 using ::trajection::Axial;
 using ::trajection::Directional;
 
@@ -244,6 +247,214 @@ EquateCollections(
     return true;
 }
 
+/**
+ * @brief
+ *     Sorted set merge source conformity.
+ * @details
+ *     Type definition which pairs a sorted set with the directional 
+ *     trajection objective used to traverse it, so that arrays of sets of 
+ *     the same type can be merged.
+ * @tparam Spatial
+ *     Type of the set.
+ * @tparam Positional
+ *     Type of positions used by the set.
+ * @tparam Natural
+ *     Type of natural integer used by the set.
+ * @tparam Elemental
+ *     Type of the elementary set objects.
+ */
+template <
+    typename Spatial,
+    typename Positional,
+    typename Natural,
+    typename Elemental>
+struct Confluent {
+
+    Referential<const Directional<const Spatial, Positional, Natural, const Elemental>>
+        direction; /**< Directional trajection objective of the set. */
+
+    Referential<const Spatial>
+        space; /**< Set being merged. */
+};
+
+/**
+ * @brief 
+ *     Merges any number of sorted sets at once.
+ * @details
+ *     The elements of all of the sets are presented to the sink function 
+ *     object in sortation order, using a loser tree so that each element 
+ *     costs a logarithmic number of comparisons in the number of sets, 
+ *     rather than the linear cost of chaining pairwise unions.  Equal 
+ *     elements are presented in the order of the sets in the array.  When
+ *     Unique is true, only the first of each group of equal elements is 
+ *     presented, which produces the union of the sets, otherwise all of 
+ *     the elements are presented, which produces their multiset sum.  The
+ *     sink must return false to abandon the merge.
+ * @tparam Spatial
+ *     Type of the sets.
+ * @tparam Positional
+ *     Type of positions used by the sets.
+ * @tparam Natural
+ *     Type of natural integer used by the sets.
+ * @tparam Elemental
+ *     Type of the elementary set objects.
+ * @tparam Ways
+ *     Maximum number of sets which can be merged.
+ * @tparam Equate
+ *     Function reference used to compare set elements for equivalence.
+ * @tparam Order
+ *     Function reference used to determine the sortation order of set 
+ *     elements.
+ * @tparam Unique
+ *     Whether equal elements are presented only once.
+ * @tparam Receptive
+ *     Type of the sink function object, which must be invocable with a 
+ *     constant element reference and return bool.
+ * @param[in] sources
+ *     Pointer to the first element of the array of sets.
+ * @param[in] count
+ *     Number of sets in the array, which must not exceed Ways.
+ * @param[in] sink
+ *     Reference to the sink function object.
+ * @return
+ *     False if there were too many sets or the sink abandoned the merge.
+ */
+template <
+    typename Spatial,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Natural Ways,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order,
+    const bool Unique,
+    typename Receptive>
+static inline bool
+MergeCollections(
+    const Locational<const Confluent<Spatial, Positional, Natural, Elemental>>
+        sources,
+    Natural
+        count,
+    Referential<const Receptive>
+        sink)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Positional positions[Ways];
+    bool remaining[Ways];
+    Natural tree[Ways];
+    Natural way;
+    Locational<const Elemental> last;
+    if (count > Ways)
+        return false;
+    if (count < 1)
+        return true;
+    for (way = 0; way < count; way++) {
+        remaining[way] = sources[way].direction.begins(sources[way].space, 0);
+        if (remaining[way])
+            sources[way].direction.scale.begin(sources[way].space, positions[way], 0);
+    }
+    auto go = [sources, &positions](Natural way) -> Referential<const Elemental> {
+        return sources[way].direction.scale.go(sources[way].space, positions[way]).to;
+    };
+    auto beats = [&remaining, &go](Natural first, Natural second) -> bool {
+        if (!remaining[first])
+            return false;
+        if (!remaining[second])
+            return true;
+        if (Order(go(first), go(second)))
+            return true;
+        if (Order(go(second), go(first)))
+            return false;
+        return first < second;
+    };
+    last = 0;
+    way = BeginTournament(tree, count, beats);
+    while (remaining[way]) {
+        Referential<const Elemental> value = go(way);
+        if (!Unique || !last || !Equate(*last, value)) {
+            if (!sink(value))
+                return false;
+            last = &value;
+        }
+        if (sources[way].direction.traverses(sources[way].space, positions[way], 1))
+            sources[way].direction.scale.traverse(sources[way].space, positions[way], 1);
+        else
+            remaining[way] = false;
+        way = ReplayTournament(tree, count, beats);
+    }
+    return true;
+}
+
+/**
+ * @brief 
+ *     Merges any number of sorted sets at once into an operand sequence.
+ * @details
+ *     Each merged element is appended to the operand using the specified
+ *     proceed function, such as the proceed function of a sequencer, as 
+ *     described for the version of this function which accepts a sink 
+ *     function object.  The operand is not emptied first.
+ * @tparam Consolidative
+ *     Type of the operand sequence.
+ * @tparam Spatial
+ *     Type of the sets.
+ * @tparam Positional
+ *     Type of positions used by the sets.
+ * @tparam Natural
+ *     Type of natural integer used by the sets.
+ * @tparam Elemental
+ *     Type of the elementary set objects.
+ * @tparam Ways
+ *     Maximum number of sets which can be merged.
+ * @tparam Equate
+ *     Function reference used to compare set elements for equivalence.
+ * @tparam Order
+ *     Function reference used to determine the sortation order of set 
+ *     elements.
+ * @tparam Unique
+ *     Whether equal elements are appended only once.
+ * @tparam Proceed
+ *     Function reference which appends an element to the operand.
+ * @param[in,out] operand
+ *     Reference to the operand sequence.
+ * @param[in] sources
+ *     Pointer to the first element of the array of sets.
+ * @param[in] count
+ *     Number of sets in the array, which must not exceed Ways.
+ * @return
+ *     False if there were too many sets or an element could not be 
+ *     appended.
+ */
+template <
+    typename Consolidative,
+    typename Spatial,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Natural Ways,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order,
+    const bool Unique,
+    Referential<bool(Referential<Consolidative>, Referential<const Elemental>)> Proceed>
+static inline bool
+MergeCollections(
+    Referential<Consolidative>
+        operand,
+    const Locational<const Confluent<Spatial, Positional, Natural, Elemental>>
+        sources,
+    Natural
+        count)
+{
+    auto proceed = [&operand](Referential<const Elemental> value) -> bool {
+        return Proceed(operand, value);
+    };
+    return MergeCollections<Spatial, Positional, Natural, Elemental, Ways, Equate, Order, Unique>(sources, count, proceed);
+}
+
 }
 
 #endif
@@ -13,6 +13,7 @@
  */
 namespace composition {
 
+using ::location::Deferential;
 using ::location::Referential;
 
 /**
@@ -117,6 +118,35 @@ struct Compositional {
                   */
 };
 
+/**
+ * @brief
+ *     Composition move classifier.
+ * @details 
+ *     This type is used alongside a composition management classifier to
+ *     incorporate elements which are moved into the composition by rvalue
+ *     reference rather than copied.  Deferrers are provided for the ordered
+ *     collections of the ration and junction modules only.
+ * @tparam Consolidative 
+ *     Type of the composition.
+ * @tparam Elemental
+ *     Type of the elements in the composition.
+ */
+template <
+    typename Consolidative,
+    typename Elemental>
+struct Deferrable {
+
+    Referential<bool(
+        Referential<Consolidative>
+            operand,
+        Deferential<Elemental>
+            value)>
+        compose; /**< Function reference used to move an element into the
+                  *   composition.  The element is left unmoved when false
+                  *   is returned.
+                  */
+};
+
 }
 
 #endif
@@ -12,6 +12,7 @@
  */
 namespace consecution {
 
+using ::location::Deferential;
 using ::location::Referential;
 using ::trajection::Directional;
 
@@ -300,6 +301,69 @@ struct Sequent {
                     */
 };
 
+/**
+ * @brief
+ *     Sequence move insertion classifier.
+ * @details
+ *     This type is used alongside a sequence classifier to insert elements
+ *     which are moved into the sequence by rvalue reference rather than
+ *     copied, for elements which own resources such as heap buffers.
+ *     Deferrers are provided for the array sequences of the ration module
+ *     and the linked list sequences of the junction module only.
+ * @tparam Consolidative
+ *     Type of the sequence.
+ * @tparam Positional 
+ *     Type of positions used by the sequence.
+ * @tparam Elemental
+ *     Type of the elements in the sequence.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Elemental>
+struct Deferrable {
+
+    Referential<bool(
+        Referential<Consolidative>
+            operand,
+        Deferential<Elemental>
+            value)>
+        accede; /**< Function reference which moves the specified element
+                 *   to the beginning of the sequence.
+                 */
+
+    Referential<bool(
+        Referential<Consolidative>
+            operand,
+        Referential<const Positional>
+            rank,
+        Deferential<Elemental>
+            value)>
+        precede; /**< Function reference which moves the specified element
+                  *   before the specified position in the sequence.
+                  */
+
+    Referential<bool(
+        Referential<Consolidative>
+            operand,
+        Referential<const Positional>
+            rank,
+        Deferential<Elemental>
+            value)>
+        cede; /**< Function reference which moves the specified element
+               *   after the specified position in the sequence.
+               */
+
+    Referential<bool(
+        Referential<Consolidative>
+            operand,
+        Deferential<Elemental>
+            value)>
+        proceed; /**< Function reference which moves the specified element
+                  *   to the end of the sequence.
+                  */
+};
+
 }
 
 #endif
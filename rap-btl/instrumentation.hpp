@@ -0,0 +1,1391 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef INSTRUMENTATION_MODULE
+#define INSTRUMENTATION_MODULE
+#include <association.hpp>
+#include <attribution.hpp>
+#include <collection.hpp>
+#include <consecution.hpp>
+#include <traction.hpp>
+#if defined(RAPBTL_INSTRUMENTATION) && defined(RAPBTL_INSTRUMENTATION_CYCLES)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(RAPBTL_NO_STD_CPLUSPLUS)
+#include <chrono>
+#else
+extern "C" {
+#include <time.h>
+}
+#endif
+#endif
+
+/**
+ * @brief
+ *     Opt-in objective instrumentation.
+ * @details
+ *     Instrumented objectives wrap the sequent, compositional, selective,
+ *     collective, associative, tractile and tributary objectives of any
+ *     implementation and record what is done with them in an instrumental
+ *     conformity declared at namespace scope, which may be shared by any
+ *     number of spaces in order to aggregate their use.  Inquiries,
+ *     insertions, replacements, removals, clearances, failures and the high
+ *     water mark of the number of elements are recorded, along with element
+ *     comparisons through probing assortive functions and the cost of the
+ *     searches made by the sortation instrumentation module.  When
+ *     RAPBTL_INSTRUMENTATION_CYCLES is also defined, a histogram of the
+ *     duration of each recorded operation is kept as well, in time stamp
+ *     counter cycles where available.  Unless RAPBTL_INSTRUMENTATION is
+ *     defined, each instrumented objective holds the very same function
+ *     references as the objective it wraps and each probing function simply
+ *     forwards to the function it wraps, so that nothing is recorded and no
+ *     overhead remains.
+ */
+namespace instrumentation {
+
+using ::association::Associative;
+using ::attribution::Tributary;
+using ::collection::Collective;
+using ::composition::Compositional;
+using ::consecution::Conjoint;
+using ::consecution::Sequent;
+using ::location::Referential;
+using ::selection::Selective;
+using ::sortation::Assortive;
+using ::traction::Tractile;
+using ::trajection::Directional;
+
+/**
+ * @brief
+ *     Instrumentation record conformity.
+ * @details
+ *     Type definition which holds what has been recorded by instrumented
+ *     objectives.  An instance used as a template argument must be declared
+ *     at namespace scope, which also zero initializes it.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ */
+template <typename Natural>
+struct Instrumental {
+
+    Natural
+        inquiries, /**< Number of element or relator inquiries. */
+        insertions, /**< Number of insertion operations. */
+        replacements, /**< Number of replacement operations. */
+        removals, /**< Number of removal operations. */
+        clearances, /**< Number of operations which removed all elements. */
+        failures, /**< Number of recorded operations which returned false. */
+        moves, /**< Number of elements moved by memory moving functions. */
+        probes, /**< Number of element comparisons by assortive functions. */
+        allocations, /**< Number of linked list nodes allocated. */
+        deallocations, /**< Number of linked list nodes deallocated. */
+        extent, /**< Number of elements after the latest modification. */
+        peak, /**< Highest number of elements after any modification. */
+        searches, /**< Number of instrumented searches made. */
+        successes, /**< Number of searches which found the value. */
+        traversals, /**< Number of positions traversed by searches. */
+        farthest; /**< Most positions traversed by any one search. */
+
+    Natural
+        cycles[64]; /**< Number of recorded operations by the base two
+                     *   logarithm of their duration, only kept when
+                     *   RAPBTL_INSTRUMENTATION_CYCLES is defined.
+                     */
+};
+
+/**
+ * @brief
+ *     Clears an instrumentation record.
+ * @details
+ *     Sets all of the counts and the histogram to zero.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @param[out] record
+ *     Reference to the instrumentation record.
+ * @return
+ *     Does not return any value.
+ */
+template <typename Natural>
+static inline void
+Initialize(Referential<Instrumental<Natural>> record)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural index;
+    record.inquiries = record.insertions = record.replacements = 0;
+    record.removals = record.clearances = record.failures = 0;
+    record.moves = record.probes = 0;
+    record.allocations = record.deallocations = 0;
+    record.extent = record.peak = 0;
+    record.searches = record.successes = 0;
+    record.traversals = record.farthest = 0;
+    for (index = 0; index < sizeof(record.cycles) / sizeof(record.cycles[0]); index++)
+        record.cycles[index] = 0;
+}
+
+/**
+ * @brief
+ *     Reads the cycle counter.
+ * @details
+ *     Reads the time stamp counter on x86 targets, otherwise a steady clock
+ *     or the processor clock.  Always returns zero unless cycle histograms
+ *     are enabled.
+ * @return
+ *     The current value of the cycle counter.
+ */
+static inline unsigned long long
+Commence()
+{
+#if defined(RAPBTL_INSTRUMENTATION) && defined(RAPBTL_INSTRUMENTATION_CYCLES)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif !defined(RAPBTL_NO_STD_CPLUSPLUS)
+    using namespace ::std::chrono;
+    return static_cast<unsigned long long>(steady_clock::now().time_since_epoch().count());
+#else
+    return static_cast<unsigned long long>(clock());
+#endif
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief
+ *     Records the conclusion of an operation.
+ * @details
+ *     Counts the operation in the specified tally, counts a failure if the
+ *     operation returned false and, when cycle histograms are enabled,
+ *     counts the duration of the operation in the histogram.  Inquiries are
+ *     concluded as successful, as false only means that nothing was found.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @param[in,out] record
+ *     Reference to the instrumentation record.
+ * @param[in,out] tally
+ *     Reference to the count of the kind of operation within the record.
+ * @param[in] result
+ *     The value which was returned by the operation.
+ * @param[in] start
+ *     Cycle counter value which was read before the operation.
+ * @return
+ *     The value which was returned by the operation.
+ */
+template <typename Natural>
+static inline bool
+Conclude(
+    Referential<Instrumental<Natural>>
+        record,
+    Referential<Natural>
+        tally,
+    bool
+        result,
+    unsigned long long
+        start)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    tally++;
+    if (!result)
+        record.failures++;
+#if defined(RAPBTL_INSTRUMENTATION) && defined(RAPBTL_INSTRUMENTATION_CYCLES)
+    unsigned long long elapsed;
+    unsigned span;
+    elapsed = (Commence() - start) >> 1;
+    for (span = 0; elapsed && span < 63; span++)
+        elapsed >>= 1;
+    record.cycles[span]++;
+#endif
+    return result;
+}
+
+/**
+ * @brief
+ *     Records the number of elements after a modification.
+ * @details
+ *     Raises the high water mark when it is exceeded.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @param[in,out] record
+ *     Reference to the instrumentation record.
+ * @param[in] extent
+ *     Number of elements after the modification.
+ * @return
+ *     Does not return any value.
+ */
+template <typename Natural>
+static inline void
+Observe(
+    Referential<Instrumental<Natural>>
+        record,
+    Natural
+        extent)
+{
+    record.extent = extent;
+    if (extent > record.peak)
+        record.peak = extent;
+}
+
+/**
+ * @brief
+ *     Assortive function which counts comparisons.
+ * @details
+ *     Counts each invocation as a probe before forwarding to the assortive
+ *     function it wraps.  Can be used wherever an equate or order assortive
+ *     function template argument is expected, such as by bisection
+ *     searches and sorted set objectives.
+ * @tparam Elemental
+ *     Type of the elements being compared.
+ * @tparam Assort
+ *     Reference to the assortive function being wrapped.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ * @param[in] first
+ *     The first element being compared.
+ * @param[in] second
+ *     The second element being compared.
+ * @return
+ *     The result of the wrapped assortive function.
+ */
+template <
+    typename Elemental,
+    Referential<Assortive<Elemental>> Assort,
+    typename Natural,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Probe(
+    Referential<const Elemental>
+        first,
+    Referential<const Elemental>
+        second)
+{
+#ifdef RAPBTL_INSTRUMENTATION
+    Record.probes++;
+#endif
+    return Assort(first, second);
+}
+
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Elemental>
+static inline Referential<const Compositional<Consolidative, Natural, Elemental>>
+Composition(Referential<const Compositional<Consolidative, Natural, Elemental>> composer)
+{
+    return composer;
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental>
+static inline Referential<const Compositional<Consolidative, Natural, Elemental>>
+Composition(Referential<const Selective<Consolidative, Positional, Natural, Elemental>> selector)
+{
+    return selector.composer;
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental>
+static inline Referential<const Compositional<Consolidative, Natural, Elemental>>
+Composition(Referential<const Collective<Consolidative, Positional, Natural, Elemental>> collector)
+{
+    return collector.selector.composer;
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Precompose(
+    Referential<Consolidative>
+        operand,
+    Referential<const Natural>
+        count)
+{
+    return Composition(Table).precompose(operand, count);
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Accredit(
+    Referential<const Consolidative>
+        operand,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Composition(Table).accredit(operand, value);
+    Conclude(Record, Record.inquiries, true, start);
+    return result;
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Compose(
+    Referential<Consolidative>
+        operand,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Composition(Table).compose(operand, value);
+    if (result)
+        Observe<Natural>(Record, Record.extent + 1);
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Recompose(
+    Referential<Consolidative>
+        operand,
+    Referential<const Elemental>
+        original,
+    Referential<const Elemental>
+        replacement)
+{
+    const unsigned long long start = Commence();
+    return Conclude(Record, Record.replacements, Composition(Table).recompose(operand, original, replacement), start);
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Discompose(
+    Referential<Consolidative>
+        operand,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Composition(Table).discompose(operand, value);
+    if (result && Record.extent > 0)
+        Record.extent--;
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Decompose(Referential<Consolidative> operand)
+{
+    const unsigned long long start = Commence();
+    const bool result = Composition(Table).decompose(operand);
+    if (result)
+        Record.extent = 0;
+    return Conclude(Record, Record.clearances, result, start);
+}
+
+template <
+    typename Objective,
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Objective> Table,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Dispose(Referential<Consolidative> operand)
+{
+    return Composition(Table).dispose(operand);
+}
+
+/**
+ * @brief
+ *     Instrumented composer objective.
+ * @details
+ *     Records inquiries, insertions, replacements, removals and clearances.
+ *     Because compositional objectives do not report the number of
+ *     elements, the extent is tracked from successful insertions, removals
+ *     and clearances, which aggregates all of the sets sharing the record.
+ * @tparam Consolidative
+ *     Type of the set.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Composer
+ *     Reference to the composer objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Elemental,
+    Referential<const Compositional<Consolidative, Natural, Elemental>> Composer,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Compositional<Consolidative, Natural, Elemental>
+    InstrumentedComposer = {
+        Precompose<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>,
+        Accredit<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>,
+        Compose<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>,
+        Recompose<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>,
+        Discompose<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>,
+        Decompose<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>,
+        Dispose<Compositional<Consolidative, Natural, Elemental>, Consolidative, Natural, Elemental, Composer, Record>
+    };
+#else
+constexpr Compositional<Consolidative, Natural, Elemental>
+    InstrumentedComposer = {
+        Composer.precompose,
+        Composer.accredit,
+        Composer.compose,
+        Composer.recompose,
+        Composer.discompose,
+        Composer.decompose,
+        Composer.dispose
+    };
+#endif
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Selective<Consolidative, Positional, Natural, Elemental>> Selector,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Compositional<Consolidative, Natural, Elemental>
+    InstrumentedSelectorComposer = {
+        Precompose<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>,
+        Accredit<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>,
+        Compose<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>,
+        Recompose<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>,
+        Discompose<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>,
+        Decompose<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>,
+        Dispose<Selective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Selector, Record>
+    };
+#else
+constexpr Compositional<Consolidative, Natural, Elemental>
+    InstrumentedSelectorComposer = {
+        Selector.composer.precompose,
+        Selector.composer.accredit,
+        Selector.composer.compose,
+        Selector.composer.recompose,
+        Selector.composer.discompose,
+        Selector.composer.decompose,
+        Selector.composer.dispose
+    };
+#endif
+
+/**
+ * @brief
+ *     Instrumented unsorted set objective.
+ * @details
+ *     The composer is instrumented as by InstrumentedComposer, while the
+ *     set operation, duplication, comparison and counting functions are
+ *     those of the wrapped selector.
+ * @tparam Consolidative
+ *     Type of the set.
+ * @tparam Positional
+ *     Type of positions within the set.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Selector
+ *     Reference to the selector objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Selective<Consolidative, Positional, Natural, Elemental>> Selector,
+    Referential<Instrumental<Natural>> Record>
+constexpr Selective<Consolidative, Positional, Natural, Elemental>
+    InstrumentedSelector = {
+        InstrumentedSelectorComposer<Consolidative, Positional, Natural, Elemental, Selector, Record>,
+        Selector.section,
+        Selector.duplicate,
+        Selector.equate,
+        Selector.count
+    };
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Collective<Consolidative, Positional, Natural, Elemental>> Collector,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Compositional<Consolidative, Natural, Elemental>
+    InstrumentedCollectorComposer = {
+        Precompose<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>,
+        Accredit<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>,
+        Compose<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>,
+        Recompose<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>,
+        Discompose<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>,
+        Decompose<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>,
+        Dispose<Collective<Consolidative, Positional, Natural, Elemental>, Consolidative, Natural, Elemental, Collector, Record>
+    };
+#else
+constexpr Compositional<Consolidative, Natural, Elemental>
+    InstrumentedCollectorComposer = {
+        Collector.selector.composer.precompose,
+        Collector.selector.composer.accredit,
+        Collector.selector.composer.compose,
+        Collector.selector.composer.recompose,
+        Collector.selector.composer.discompose,
+        Collector.selector.composer.decompose,
+        Collector.selector.composer.dispose
+    };
+#endif
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Collective<Consolidative, Positional, Natural, Elemental>> Collector,
+    Referential<Instrumental<Natural>> Record>
+constexpr Selective<Consolidative, Positional, Natural, Elemental>
+    InstrumentedCollectorSelector = {
+        InstrumentedCollectorComposer<Consolidative, Positional, Natural, Elemental, Collector, Record>,
+        Collector.selector.section,
+        Collector.selector.duplicate,
+        Collector.selector.equate,
+        Collector.selector.count
+    };
+
+/**
+ * @brief
+ *     Instrumented sorted set objective.
+ * @details
+ *     The composer of the selector is instrumented as by
+ *     InstrumentedComposer, while all other functions are those of the
+ *     wrapped collector.  Comparisons made by sorted set searches can be
+ *     recorded by instantiating the wrapped collector with Probe assortive
+ *     functions.
+ * @tparam Consolidative
+ *     Type of the set.
+ * @tparam Positional
+ *     Type of positions within the set.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Collector
+ *     Reference to the collector objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Collective<Consolidative, Positional, Natural, Elemental>> Collector,
+    Referential<Instrumental<Natural>> Record>
+constexpr Collective<Consolidative, Positional, Natural, Elemental>
+    InstrumentedCollector = {
+        InstrumentedCollectorSelector<Consolidative, Positional, Natural, Elemental, Collector, Record>,
+        Collector.bisection,
+        Collector.collate,
+        Collector.correlate
+    };
+
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Correlative,
+    typename Evaluative,
+    Referential<const Associative<Consolidative, Natural, Correlative, Evaluative>> Associator,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Correspond(
+    Referential<const Consolidative>
+        map,
+    Referential<const Correlative>
+        relator)
+{
+    const unsigned long long start = Commence();
+    const bool result = Associator.correspond(map, relator);
+    Conclude(Record, Record.inquiries, true, start);
+    return result;
+}
+
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Correlative,
+    typename Evaluative,
+    Referential<const Associative<Consolidative, Natural, Correlative, Evaluative>> Associator,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Associate(
+    Referential<Consolidative>
+        map,
+    Referential<const Correlative>
+        relator,
+    Referential<const Evaluative>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Associator.associate(map, relator, value);
+    Observe(Record, Associator.grade(map));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Correlative,
+    typename Evaluative,
+    Referential<const Associative<Consolidative, Natural, Correlative, Evaluative>> Associator,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Reassociate(
+    Referential<Consolidative>
+        map,
+    Referential<const Correlative>
+        original,
+    Referential<const Correlative>
+        replacement)
+{
+    const unsigned long long start = Commence();
+    return Conclude(Record, Record.replacements, Associator.reassociate(map, original, replacement), start);
+}
+
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Correlative,
+    typename Evaluative,
+    Referential<const Associative<Consolidative, Natural, Correlative, Evaluative>> Associator,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Disassociate(
+    Referential<Consolidative>
+        map,
+    Referential<const Correlative>
+        relator)
+{
+    const unsigned long long start = Commence();
+    const bool result = Associator.disassociate(map, relator);
+    Observe(Record, Associator.grade(map));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Correlative,
+    typename Evaluative,
+    Referential<const Associative<Consolidative, Natural, Correlative, Evaluative>> Associator,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Disband(Referential<Consolidative> map)
+{
+    const unsigned long long start = Commence();
+    const bool result = Associator.disband(map);
+    Observe(Record, Associator.grade(map));
+    return Conclude(Record, Record.clearances, result, start);
+}
+
+/**
+ * @brief
+ *     Instrumented associative map objective.
+ * @details
+ *     Records relator inquiries, associations, reassociations,
+ *     disassociations and disbands, and the number of mappings in the map
+ *     after each modification.
+ * @tparam Consolidative
+ *     Type of the map.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Correlative
+ *     Type of the relators (keys).
+ * @tparam Evaluative
+ *     Type of the values.
+ * @tparam Associator
+ *     Reference to the associator objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Natural,
+    typename Correlative,
+    typename Evaluative,
+    Referential<const Associative<Consolidative, Natural, Correlative, Evaluative>> Associator,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Associative<Consolidative, Natural, Correlative, Evaluative>
+    InstrumentedAssociator = {
+        Associator.prepare,
+        Associator.grade,
+        Correspond<Consolidative, Natural, Correlative, Evaluative, Associator, Record>,
+        Associate<Consolidative, Natural, Correlative, Evaluative, Associator, Record>,
+        Reassociate<Consolidative, Natural, Correlative, Evaluative, Associator, Record>,
+        Disassociate<Consolidative, Natural, Correlative, Evaluative, Associator, Record>,
+        Disband<Consolidative, Natural, Correlative, Evaluative, Associator, Record>,
+        Associator.dissolve
+    };
+#else
+constexpr Associative<Consolidative, Natural, Correlative, Evaluative>
+    InstrumentedAssociator = {
+        Associator.prepare,
+        Associator.grade,
+        Associator.correspond,
+        Associator.associate,
+        Associator.reassociate,
+        Associator.disassociate,
+        Associator.disband,
+        Associator.dissolve
+    };
+#endif
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tractile<Consolidative, Positional, Natural>> Tractor,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Protract(
+    Referential<Consolidative>
+        operand,
+    Referential<Positional>
+        position,
+    Referential<const Natural>
+        count)
+{
+    const unsigned long long start = Commence();
+    const bool result = Tractor.protract(operand, position, count);
+    Observe(Record, Tractor.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tractile<Consolidative, Positional, Natural>> Tractor,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Retract(
+    Referential<Consolidative>
+        operand,
+    Referential<const Natural>
+        count)
+{
+    const unsigned long long start = Commence();
+    const bool result = Tractor.retract(operand, count);
+    Observe(Record, Tractor.account(operand));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tractile<Consolidative, Positional, Natural>> Tractor,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Contract(Referential<Consolidative> operand)
+{
+    const unsigned long long start = Commence();
+    const bool result = Tractor.contract(operand);
+    Observe(Record, Tractor.account(operand));
+    return Conclude(Record, Record.clearances, result, start);
+}
+
+/**
+ * @brief
+ *     Instrumented stack or queue objective.
+ * @details
+ *     Records protractions as insertions, retractions as removals and
+ *     contractions as clearances, and the number of allotted elements after
+ *     each of them.
+ * @tparam Consolidative
+ *     Type of the stack or queue.
+ * @tparam Positional
+ *     Type of positions within the stack or queue.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Tractor
+ *     Reference to the tractile objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tractile<Consolidative, Positional, Natural>> Tractor,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Tractile<Consolidative, Positional, Natural>
+    InstrumentedTractor = {
+        Tractor.survey,
+        Tractor.account,
+        Protract<Consolidative, Positional, Natural, Tractor, Record>,
+        Retract<Consolidative, Positional, Natural, Tractor, Record>,
+        Contract<Consolidative, Positional, Natural, Tractor, Record>
+    };
+#else
+constexpr Tractile<Consolidative, Positional, Natural>
+    InstrumentedTractor = {
+        Tractor.survey,
+        Tractor.account,
+        Tractor.protract,
+        Tractor.retract,
+        Tractor.contract
+    };
+#endif
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tributary<Consolidative, Positional, Natural>> Contributor,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Distribute(
+    Referential<Consolidative>
+        pool,
+    Referential<Positional>
+        position)
+{
+    const unsigned long long start = Commence();
+    const bool result = Contributor.distribute(pool, position);
+    Observe(Record, Contributor.account(pool));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tributary<Consolidative, Positional, Natural>> Contributor,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Retribute(
+    Referential<Consolidative>
+        pool,
+    Referential<const Positional>
+        position)
+{
+    const unsigned long long start = Commence();
+    const bool result = Contributor.retribute(pool, position);
+    Observe(Record, Contributor.account(pool));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tributary<Consolidative, Positional, Natural>> Contributor,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Contribute(Referential<Consolidative> pool)
+{
+    const unsigned long long start = Commence();
+    const bool result = Contributor.contribute(pool);
+    Observe(Record, Contributor.account(pool));
+    return Conclude(Record, Record.clearances, result, start);
+}
+
+/**
+ * @brief
+ *     Instrumented pool objective.
+ * @details
+ *     Records distributions as insertions, retributions as removals and
+ *     contributions as clearances, and the number of distributed elements
+ *     after each of them.
+ * @tparam Consolidative
+ *     Type of the pool.
+ * @tparam Positional
+ *     Type of positions within the pool.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Contributor
+ *     Reference to the tributary objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    Referential<const Tributary<Consolidative, Positional, Natural>> Contributor,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Tributary<Consolidative, Positional, Natural>
+    InstrumentedContributor = {
+        Contributor.survey,
+        Contributor.account,
+        Distribute<Consolidative, Positional, Natural, Contributor, Record>,
+        Retribute<Consolidative, Positional, Natural, Contributor, Record>,
+        Contribute<Consolidative, Positional, Natural, Contributor, Record>
+    };
+#else
+constexpr Tributary<Consolidative, Positional, Natural>
+    InstrumentedContributor = {
+        Contributor.survey,
+        Contributor.account,
+        Contributor.distribute,
+        Contributor.retribute,
+        Contributor.contribute
+    };
+#endif
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+AccedeRange(
+    Referential<Consolidative>
+        operand,
+    Referential<const Directional<const Consolidative, Positional, Natural, const Elemental>>
+        relativity,
+    Referential<const Consolidative>
+        relative,
+    Referential<const Positional>
+        first,
+    Referential<const Positional>
+        last)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.conjoiner.accede(operand, relativity, relative, first, last);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+PrecedeRange(
+    Referential<Consolidative>
+        operand,
+    Referential<const Positional>
+        rank,
+    Referential<const Directional<const Consolidative, Positional, Natural, const Elemental>>
+        relativity,
+    Referential<const Consolidative>
+        relative,
+    Referential<const Positional>
+        first,
+    Referential<const Positional>
+        last)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.conjoiner.precede(operand, rank, relativity, relative, first, last);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+CedeRange(
+    Referential<Consolidative>
+        operand,
+    Referential<const Positional>
+        rank,
+    Referential<const Directional<const Consolidative, Positional, Natural, const Elemental>>
+        relativity,
+    Referential<const Consolidative>
+        relative,
+    Referential<const Positional>
+        first,
+    Referential<const Positional>
+        last)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.conjoiner.cede(operand, rank, relativity, relative, first, last);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+ProceedRange(
+    Referential<Consolidative>
+        operand,
+    Referential<const Directional<const Consolidative, Positional, Natural, const Elemental>>
+        relativity,
+    Referential<const Consolidative>
+        relative,
+    Referential<const Positional>
+        first,
+    Referential<const Positional>
+        last)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.conjoiner.proceed(operand, relativity, relative, first, last);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+/**
+ * @brief
+ *     Instrumented conjoiner objective of a sequencer.
+ * @details
+ *     Records each batch insertion as one insertion, along with the number
+ *     of elements in the sequence afterwards.
+ * @tparam Consolidative
+ *     Type of the sequence.
+ * @tparam Positional
+ *     Type of positions within the sequence.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Sequencer
+ *     Reference to the sequencer objective whose conjoiner is wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Conjoint<Consolidative, Positional, Consolidative, Positional, Natural, Elemental>
+    InstrumentedConjoiner = {
+        AccedeRange<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        PrecedeRange<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        CedeRange<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        ProceedRange<Consolidative, Positional, Natural, Elemental, Sequencer, Record>
+    };
+#else
+constexpr Conjoint<Consolidative, Positional, Consolidative, Positional, Natural, Elemental>
+    InstrumentedConjoiner = {
+        Sequencer.conjoiner.accede,
+        Sequencer.conjoiner.precede,
+        Sequencer.conjoiner.cede,
+        Sequencer.conjoiner.proceed
+    };
+#endif
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Accede(
+    Referential<Consolidative>
+        operand,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.accede(operand, value);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Precede(
+    Referential<Consolidative>
+        operand,
+    Referential<const Positional>
+        rank,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.precede(operand, rank, value);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Cede(
+    Referential<Consolidative>
+        operand,
+    Referential<const Positional>
+        rank,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.cede(operand, rank, value);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Proceed(
+    Referential<Consolidative>
+        operand,
+    Referential<const Elemental>
+        value)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.proceed(operand, value);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.insertions, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Succeed(
+    Referential<Consolidative>
+        operand,
+    Referential<const Natural>
+        count)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.succeed(operand, count);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Supersede(
+    Referential<Consolidative>
+        operand,
+    Referential<const Positional>
+        rank,
+    Referential<const Natural>
+        count)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.supersede(operand, rank, count);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Concede(
+    Referential<Consolidative>
+        operand,
+    Referential<const Positional>
+        rank,
+    Referential<const Natural>
+        count)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.concede(operand, rank, count);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Recede(
+    Referential<Consolidative>
+        operand,
+    Referential<const Natural>
+        count)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.recede(operand, count);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.removals, result, start);
+}
+
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+static inline bool
+Secede(Referential<Consolidative> operand)
+{
+    const unsigned long long start = Commence();
+    const bool result = Sequencer.secede(operand);
+    Observe(Record, Sequencer.account(operand));
+    return Conclude(Record, Record.clearances, result, start);
+}
+
+/**
+ * @brief
+ *     Instrumented sequencer objective.
+ * @details
+ *     Records single element insertions and removals, secessions as
+ *     clearances and the number of elements in the sequence after each of
+ *     them.  Batch insertions are recorded by the conjoiner as by
+ *     InstrumentedConjoiner.
+ * @tparam Consolidative
+ *     Type of the sequence.
+ * @tparam Positional
+ *     Type of positions within the sequence.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Sequencer
+ *     Reference to the sequencer objective being wrapped.
+ * @tparam Record
+ *     Reference to the instrumentation record.
+ */
+template <
+    typename Consolidative,
+    typename Positional,
+    typename Natural,
+    typename Elemental,
+    Referential<const Sequent<Consolidative, Positional, Natural, Elemental>> Sequencer,
+    Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+constexpr Sequent<Consolidative, Positional, Natural, Elemental>
+    InstrumentedSequencer = {
+        Sequencer.antecede,
+        Sequencer.account,
+        Accede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Precede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Cede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Proceed<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Succeed<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Supersede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Concede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Recede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Secede<Consolidative, Positional, Natural, Elemental, Sequencer, Record>,
+        Sequencer.condense,
+        InstrumentedConjoiner<Consolidative, Positional, Natural, Elemental, Sequencer, Record>
+    };
+#else
+constexpr Sequent<Consolidative, Positional, Natural, Elemental>
+    InstrumentedSequencer = {
+        Sequencer.antecede,
+        Sequencer.account,
+        Sequencer.accede,
+        Sequencer.precede,
+        Sequencer.cede,
+        Sequencer.proceed,
+        Sequencer.succeed,
+        Sequencer.supersede,
+        Sequencer.concede,
+        Sequencer.recede,
+        Sequencer.secede,
+        Sequencer.condense,
+        Sequencer.conjoiner
+    };
+#endif
+
+}
+
+#endif
@@ -14,15 +14,18 @@
 namespace junction {
 
 using ::allocation::Allocative;
+using ::allocation::ArrayClaimable;
 using ::allocation::CopyClaimable;
 using ::allocation::DefaultClaimable;
 using ::allocation::DefaultDisclaimable;
+using ::allocation::FastArrayNew;
 using ::allocation::FastCopyNew;
 using ::allocation::FastDefaultNew;
 using ::comparison::Comparative;
 using ::comparison::Equative;
 using ::comparison::Relational;
 using ::location::Conferential;
+using ::location::Deferential;
 using ::location::Locational;
 using ::location::Positive;
 using ::location::Referential;
@@ -187,7 +190,9 @@ struct Adjunctive {
     Referential<Locational<Nodal<Connective, Elemental>>(Referential<Junctive<Connective, Natural, Elemental>>)>
         allocate; /**< Allocates one or more uninitialized nodes.  
                    *   Implementations may simply return null if this 
-                   *   operation is not supported.
+                   *   operation is not supported, in which case values
+                   *   deferred to the list are copied into nodes using
+                   *   the proclaim operation instead of being moved.
                    */
 
     Referential<bool(Referential<Junctive<Connective, Natural, Elemental>>, Referential<Locational<Nodal<Connective, Elemental>>>)>
@@ -236,6 +241,99 @@ template <
     typename Elemental>
 using DoublyAdjunctive = Adjunctive<DoublyLinked<Elemental>, Natural, Elemental>;
 
+/**
+ * @brief
+ *     Linked list node array management classifier.
+ * @details
+ *     This type is used to allocate and free contiguous arrays of linked
+ *     list nodes in a single operation each.  Neither function modifies 
+ *     the node counts of the list.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+struct ArrayAdjunctive {
+
+    Referential<Locational<Nodal<Connective, Elemental>>(Referential<Junctive<Connective, Natural, Elemental>>, Referential<const Natural>)>
+        allocate; /**< Allocates an array of the specified number of 
+                   *   uninitialized nodes, returning null on failure.
+                   */
+
+    Referential<bool(Referential<Junctive<Connective, Natural, Elemental>>, Referential<Locational<Nodal<Connective, Elemental>>>)>
+        deallocate; /**< Frees an array of nodes which was returned by 
+                     *   allocate and whose nodes have all been removed 
+                     *   from the active node list and unused node sublist.
+                     */
+};
+
+/**
+ * @brief 
+ *     Singly linked list node array management classifier.
+ * @details  
+ *     This type alias is used to represent a singly linked list node array
+ *     management adjunct.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+using SinglyArrayAdjunctive = ArrayAdjunctive<SinglyLinked<Elemental>, Natural, Elemental>;
+
+/**
+ * @brief 
+ *     Doubly linked list node array management classifier.
+ * @details  
+ *     This type alias is used to represent a doubly linked list node array
+ *     management adjunct.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+using DoublyArrayAdjunctive = ArrayAdjunctive<DoublyLinked<Elemental>, Natural, Elemental>;
+
+/**
+ * @brief
+ *     Linked list node reservation conformity.
+ * @details
+ *     This type is used to record an array of nodes which was reserved for
+ *     a linked list so that it can later be trimmed from the list and 
+ *     freed as a whole.  The list must be managed with a reserved adjunct
+ *     referring to the reservation, so that its nodes are never freed one
+ *     at a time.
+ * @tparam Connective
+ *     Type of the node linkage.
+ * @tparam Natural
+ *     Type of unsigned integer.
+ * @tparam Elemental
+ *     Type of the elements.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental>
+struct Reservative {
+
+    Locational<Nodal<Connective, Elemental>>
+        nodes; /**< First node of the reserved array. */
+
+    Natural
+        count; /**< Number of nodes in the reserved array. */
+};
+
 /**
  * @brief
  *     Linked list position conformity.
@@ -775,6 +873,184 @@ IntegrateNodes(
     return IntegrateNodes(list, nodes, Count);
 }
 
+// The nodes of a reservation are threaded onto the unused sublist in array
+// order.  Lists holding a reservation must be managed with a reserved
+// adjunct, whose deallocate refuses the nodes of the reservation, so that
+// they are only released as a whole using Trim.
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental,
+    Referential<const ArrayAdjunctive<Connective, Natural, Elemental>> Adjunct>
+static inline bool
+Reserve(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Referential<Reservative<Connective, Natural, Elemental>>
+        reservation,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+    NodeLocational nodes;
+    if (count < 1)
+        return false;
+    nodes = Adjunct.allocate(list, count);
+    if (!nodes)
+        return false;
+    IntegrateNodes(list, nodes, count);
+    reservation.nodes = nodes;
+    reservation.count = count;
+    return true;
+}
+
+// Returns false without releasing any node from the list unless every node
+// of the reservation is in the unused sublist and the array is freed.  The
+// reserved nodes are gathered at the front of the unused sublist before the
+// array is freed, so that the sublist is only detached from them once the
+// deallocate function of the adjunct has succeeded.
+template <
+    typename Natural,
+    typename Elemental,
+    Referential<const SinglyArrayAdjunctive<Natural, Elemental>> Adjunct>
+static inline bool
+Trim(
+    Referential<SinglyJunctive<Natural, Elemental>>
+        list,
+    Referential<Reservative<SinglyLinked<Elemental>, Natural, Elemental>>
+        reservation)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<SinglyNodal<Elemental>>;
+    auto reserved = [&](const NodeLocational node) -> bool {
+        return node >= reservation.nodes && node < reservation.nodes + reservation.count;
+    };
+    NodeLocational current, next, first, last, remainder, tail;
+    Natural count;
+    if (!reservation.nodes)
+        return false;
+    count = 0;
+    for (current = list.unused; current; current = GetNext(current))
+        if (reserved(current))
+            count++;
+    if (count != reservation.count)
+        return false;
+    first = last = remainder = tail = 0;
+    for (current = list.unused; current; current = next) {
+        next = GetNext(current);
+        if (reserved(current)) {
+            if (last)
+                SetNext(last, current);
+            else
+                first = current;
+            last = current;
+        } else {
+            if (tail)
+                SetNext(tail, current);
+            else
+                remainder = current;
+            tail = current;
+        }
+    }
+    if (tail)
+        UnsetNext(tail);
+    SetNext(last, remainder);
+    list.unused = first;
+    if (!Adjunct.deallocate(list, reservation.nodes))
+        return false;
+    list.unused = remainder;
+    list.total -= count;
+    reservation.nodes = 0;
+    reservation.count = 0;
+    return true;
+}
+
+// Returns false without releasing any node from the list unless every node
+// of the reservation is in the unused sublist and the array is freed.  The
+// reserved nodes are gathered at the front of the unused sublist before the
+// array is freed, so that the sublist is only detached from them once the
+// deallocate function of the adjunct has succeeded.
+template <
+    typename Natural,
+    typename Elemental,
+    Referential<const DoublyArrayAdjunctive<Natural, Elemental>> Adjunct>
+static inline bool
+Trim(
+    Referential<DoublyJunctive<Natural, Elemental>>
+        list,
+    Referential<Reservative<DoublyLinked<Elemental>, Natural, Elemental>>
+        reservation)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<DoublyNodal<Elemental>>;
+    auto reserved = [&](const NodeLocational node) -> bool {
+        return node >= reservation.nodes && node < reservation.nodes + reservation.count;
+    };
+    NodeLocational current, next, first, last, remainder, tail;
+    Natural count;
+    if (!reservation.nodes)
+        return false;
+    count = 0;
+    for (current = list.unused; current; current = GetNext(current))
+        if (reserved(current))
+            count++;
+    if (count != reservation.count)
+        return false;
+    first = last = remainder = tail = 0;
+    for (current = list.unused; current; current = next) {
+        next = GetNext(current);
+        if (reserved(current)) {
+            if (last) {
+                ConnectNext(last, current);
+            } else {
+                UnsetPrevious(current);
+                first = current;
+            }
+            last = current;
+        } else {
+            if (tail) {
+                ConnectNext(tail, current);
+            } else {
+                UnsetPrevious(current);
+                remainder = current;
+            }
+            tail = current;
+        }
+    }
+    if (tail)
+        UnsetNext(tail);
+    if (remainder)
+        ConnectNext(last, remainder);
+    else
+        UnsetNext(last);
+    list.unused = first;
+    if (!Adjunct.deallocate(list, reservation.nodes))
+        return false;
+    if (remainder)
+        UnsetPrevious(remainder);
+    list.unused = remainder;
+    list.total -= count;
+    reservation.nodes = 0;
+    reservation.count = 0;
+    return true;
+}
+
 template <
     typename Connective,
     typename Natural,
@@ -974,6 +1250,83 @@ DeallocateDefault(
     return false;
 }
 
+template <
+    typename Connective,
+    typename Disclaimable,
+    typename Natural,
+    typename Elemental,
+    Referential<const Allocative<ArrayClaimable<Natural, Nodal<Connective, Elemental>>, Disclaimable>> Allocator>
+static inline Locational<Nodal<Connective, Elemental>>
+AllocateArray(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+    NodeLocational result;
+    Allocator.claim(result, count);
+    return result;
+}
+
+template <
+    typename Connective,
+    typename Claimable,
+    typename Natural,
+    typename Elemental,
+    Referential<const Allocative<Claimable, DefaultDisclaimable<Nodal<Connective, Elemental>>>> Allocator>
+static inline bool
+DeallocateArray(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Referential<Locational<Nodal<Connective, Elemental>>>
+        nodes)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (nodes) {
+        Allocator.disclaim(nodes);
+        return true;
+    }
+    return false;
+}
+
+// Returns false for nodes of the reservation so that they are left in the
+// unused sublist until the reservation is trimmed as a whole.
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental,
+    Referential<Reservative<Connective, Natural, Elemental>> Reservation,
+    Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct>
+static inline bool
+DeallocateUnreserved(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Referential<Locational<Nodal<Connective, Elemental>>>
+        node)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (Reservation.nodes && node >= Reservation.nodes && node < Reservation.nodes + Reservation.count)
+        return false;
+    return Adjunct.deallocate(list, node);
+}
+
 template <
     typename Connective,
     typename Disclaimable,
@@ -1085,6 +1438,82 @@ ProclaimCopy(
     return result;
 }
 
+// Moves the value into a recycled or newly allocated node.  Adjuncts
+// which cannot allocate uninitialized nodes, and so return null from
+// their allocate operation, fall back to proclaiming a copy of the value.
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental,
+    Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct>
+static inline Locational<Nodal<Connective, Elemental>>
+ProclaimDeferent(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Deferential<Elemental>
+        value)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+    NodeLocational result;
+    result = Reclaim(list);
+    if (!result)
+        result = Adjunct.allocate(list);
+    if (!result)
+        return Adjunct.proclaim(list, value);
+    result->element = static_cast<Deferential<Elemental>>(value);
+    return result;
+}
+
+// Proclaims a node with a copy of the value.
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental,
+    Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct>
+static inline Locational<Nodal<Connective, Elemental>>
+ProclaimValue(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Referential<const Elemental>
+        value)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return Adjunct.proclaim(list, value);
+}
+
+// Proclaims a node with the value moved into it.
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental,
+    Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct>
+static inline Locational<Nodal<Connective, Elemental>>
+ProclaimValue(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Deferential<Elemental>
+        value)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return ProclaimDeferent<Connective, Natural, Elemental, Adjunct>(list, static_cast<Deferential<Elemental>>(value));
+}
+
 template <
     typename Connective,
     typename Natural,
@@ -1394,6 +1823,54 @@ constexpr DoublyAdjunctive<Natural, Elemental>
         ProclaimDefault<DoublyLinked<Elemental>, DefaultDisclaimable<DoublyNodal<Elemental>>, Natural, Elemental, FastDefaultNew<DoublyNodal<Elemental>>>
     };
 
+template <
+    typename Natural,
+    typename Elemental>
+constexpr SinglyArrayAdjunctive<Natural, Elemental>
+    ArrayNewSingleAdjunct = {
+        AllocateArray<SinglyLinked<Elemental>, DefaultDisclaimable<SinglyNodal<Elemental>>, Natural, Elemental, FastArrayNew<Natural, SinglyNodal<Elemental>>>,
+        DeallocateArray<SinglyLinked<Elemental>, ArrayClaimable<Natural, SinglyNodal<Elemental>>, Natural, Elemental, FastArrayNew<Natural, SinglyNodal<Elemental>>>
+    };
+
+template <
+    typename Natural,
+    typename Elemental>
+constexpr DoublyArrayAdjunctive<Natural, Elemental>
+    ArrayNewDoubleAdjunct = {
+        AllocateArray<DoublyLinked<Elemental>, DefaultDisclaimable<DoublyNodal<Elemental>>, Natural, Elemental, FastArrayNew<Natural, DoublyNodal<Elemental>>>,
+        DeallocateArray<DoublyLinked<Elemental>, ArrayClaimable<Natural, DoublyNodal<Elemental>>, Natural, Elemental, FastArrayNew<Natural, DoublyNodal<Elemental>>>
+    };
+
+// Nodes outside of the reservation are managed by the specified adjunct.
+// Condensing a list managed by a reserved adjunct stops at the first node
+// of the reservation found in the unused sublist.
+template <
+    typename Natural,
+    typename Elemental,
+    Referential<Reservative<SinglyLinked<Elemental>, Natural, Elemental>> Reservation,
+    Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct = DefaultNewSingleAdjunct<Natural, Elemental>>
+constexpr SinglyAdjunctive<Natural, Elemental>
+    ReservedSingleAdjunct = {
+        Adjunct.allocate,
+        DeallocateUnreserved<SinglyLinked<Elemental>, Natural, Elemental, Reservation, Adjunct>,
+        Adjunct.proclaim
+    };
+
+// Nodes outside of the reservation are managed by the specified adjunct.
+// Condensing a list managed by a reserved adjunct stops at the first node
+// of the reservation found in the unused sublist.
+template <
+    typename Natural,
+    typename Elemental,
+    Referential<Reservative<DoublyLinked<Elemental>, Natural, Elemental>> Reservation,
+    Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct = DefaultNewDoubleAdjunct<Natural, Elemental>>
+constexpr DoublyAdjunctive<Natural, Elemental>
+    ReservedDoubleAdjunct = {
+        Adjunct.allocate,
+        DeallocateUnreserved<DoublyLinked<Elemental>, Natural, Elemental, Reservation, Adjunct>,
+        Adjunct.proclaim
+    };
+
 template <
     typename Natural,
     typename Elemental>
@@ -0,0 +1,1109 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef JUNCTION_ANTICIPATION_MODULE
+#define JUNCTION_ANTICIPATION_MODULE
+#include <junction.hpp>
+
+namespace junction {
+
+/**
+ * @brief         
+ *     Linked list prefetching trajection implementation.
+ * @details       
+ *     Linked list trajection implementation which requests the node 
+ *     subsequent to each position it moves to from memory before it is 
+ *     needed, so that the caller's work on the element at the position 
+ *     overlaps the memory latency of the next step.  The scales, liners,
+ *     directions and axes are drop in replacements for those of the linked
+ *     list module.  Saltatory spaces additionally record every k-th node of
+ *     a list so that positions can be reached in at most k steps from a 
+ *     recorded node rather than by walking from the origin of the list.
+ *     Positions in saltatory spaces carry the index of their node, so that
+ *     the leap liner and directions can also leap when traversing from a
+ *     position, such as when searching a sorted list bisectionally.
+ *     Prefetching is only requested from compilers which support the 
+ *     __builtin_prefetch intrinsic.
+ */
+namespace anticipation {
+
+    /**
+     * @brief 
+     *     Jump pointer conformity.
+     * @details  
+     *     This type is used to represent a linked list together with an 
+     *     array recording every interval-th node of the list, beginning 
+     *     with the first node.  The array must be marked again after any 
+     *     modification of the list.
+     * @tparam Connective
+     *     Type of the node linkage.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    struct Saltatory {
+
+        Locational<const Junctive<Connective, Natural, Elemental>>
+            list; /**< The list which was marked. */
+
+        Locational<Locational<Nodal<Connective, Elemental>>>
+            nodes; /**< Array of every interval-th node in the list. */
+
+        Natural
+            length, /**< Number of entries available in the array. */
+            count, /**< Number of entries recorded in the array. */
+            interval; /**< Number of nodes between recorded nodes. */
+    };
+
+    /**
+     * @brief 
+     *     Singly linked jump pointer conformity.
+     * @details  
+     *     This type alias is used to represent a singly linked list with 
+     *     jump pointers.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Natural,
+        typename Elemental>
+    using SinglySaltatory = Saltatory<SinglyLinked<Elemental>, Natural, Elemental>;
+
+    /**
+     * @brief 
+     *     Doubly linked jump pointer conformity.
+     * @details  
+     *     This type alias is used to represent a doubly linked list with 
+     *     jump pointers.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Natural,
+        typename Elemental>
+    using DoublySaltatory = Saltatory<DoublyLinked<Elemental>, Natural, Elemental>;
+
+    /**
+     * @brief 
+     *     Jump pointer position conformity.
+     * @details  
+     *     This type is used to represent a position in a list with jump 
+     *     pointers together with the index of the node at the position, so
+     *     that trajection can leap to a node from the nearest recorded node
+     *     rather than walking to it from the position.
+     * @tparam Connective
+     *     Type of the node linkage.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    struct Saltant {
+
+        Locational<Nodal<Connective, Elemental>>
+            at; /**< Pointer to the node at the position. */
+
+        Natural
+            index; /**< Number of nodes preceding the node in the list. */
+    };
+
+    /**
+     * @brief 
+     *     Singly linked jump pointer position conformity.
+     * @details  
+     *     This type alias is used to represent a position in a singly linked
+     *     list with jump pointers.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Natural,
+        typename Elemental>
+    using SinglySaltant = Saltant<SinglyLinked<Elemental>, Natural, Elemental>;
+
+    /**
+     * @brief 
+     *     Doubly linked jump pointer position conformity.
+     * @details  
+     *     This type alias is used to represent a position in a doubly linked
+     *     list with jump pointers.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Natural,
+        typename Elemental>
+    using DoublySaltant = Saltant<DoublyLinked<Elemental>, Natural, Elemental>;
+
+    template <typename Subjective>
+    static inline void
+    PrefetchRead(
+        const Locational<const Subjective>
+            location)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(location, 0, 3);
+#endif
+    }
+
+    template <typename Subjective>
+    static inline void
+    PrefetchWrite(
+        const Locational<Subjective>
+            location)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(location, 1, 3);
+#endif
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<Original<Connective, Natural, Elemental>> GetOrigin,
+        Referential<Subsequent<Connective, Elemental>> GetSubsequent>
+    static inline Referential<const Positional<Connective, Elemental>>
+    BeginReadScale(
+        Referential<const Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<Positional<Connective, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural index;
+        current = GetOrigin(list);
+        for (index = 0; index < count; index++)
+            current = GetSubsequent(current);
+        if (current)
+            PrefetchRead<Nodal<Connective, Elemental>>(GetSubsequent(current));
+        position.at = current;
+        return position;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<Original<Connective, Natural, Elemental>> GetOrigin,
+        Referential<Subsequent<Connective, Elemental>> GetSubsequent>
+    static inline Referential<const Positional<Connective, Elemental>>
+    BeginWriteScale(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<Positional<Connective, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural index;
+        current = GetOrigin(list);
+        for (index = 0; index < count; index++)
+            current = GetSubsequent(current);
+        if (current)
+            PrefetchWrite<Nodal<Connective, Elemental>>(GetSubsequent(current));
+        position.at = current;
+        return position;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<Subsequent<Connective, Elemental>> GetSubsequent>
+    static inline Referential<const Positional<Connective, Elemental>>
+    TraverseReadScale(
+        Referential<const Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<Positional<Connective, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural index;
+        current = position.at;
+        for (index = 0; index < count; index++)
+            current = GetSubsequent(current);
+        if (current)
+            PrefetchRead<Nodal<Connective, Elemental>>(GetSubsequent(current));
+        position.at = current;
+        return position;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<Subsequent<Connective, Elemental>> GetSubsequent>
+    static inline Referential<const Positional<Connective, Elemental>>
+    TraverseWriteScale(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<Positional<Connective, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural index;
+        current = position.at;
+        for (index = 0; index < count; index++)
+            current = GetSubsequent(current);
+        if (current)
+            PrefetchWrite<Nodal<Connective, Elemental>>(GetSubsequent(current));
+        position.at = current;
+        return position;
+    }
+
+    // Returns false if the array was too short to record every 
+    // interval-th node of the list, in which case positions beyond the 
+    // last recorded node are still reached by walking from it.
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Mark(
+        Referential<Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Junctive<Connective, Natural, Elemental>>
+            list,
+        const Locational<Locational<Nodal<Connective, Elemental>>>
+            nodes,
+        Referential<const Natural>
+            length,
+        Referential<const Natural>
+            interval)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural index;
+        space.list = &list;
+        space.nodes = nodes;
+        space.length = length;
+        space.count = 0;
+        space.interval = interval;
+        if (interval < 1)
+            return false;
+        for (index = 0, current = list.first; current; index++, current = GetNext(current)) {
+            if (index % interval)
+                continue;
+            if (space.count >= length)
+                return false;
+            nodes[space.count++] = current;
+        }
+        return true;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline Locational<Nodal<Connective, Elemental>>
+    Leap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Natural>
+            index)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural entry, step;
+        if (index >= space.list->count)
+            return 0;
+        if (space.count) {
+            entry = index / space.interval;
+            if (entry >= space.count)
+                entry = space.count - 1;
+            current = space.nodes[entry];
+            step = entry * space.interval;
+        } else {
+            current = space.list->first;
+            step = 0;
+        }
+        for (; step < index; step++)
+            current = GetNext(current);
+        return current;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    IsEqualLeap(
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            base,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            relative)
+    {
+        return base.at == relative.at;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    IsNotEqualLeap(
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            base,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            relative)
+    {
+        return base.at != relative.at;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    IsLesserLeap(
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            base,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            relative)
+    {
+        return base.index < relative.index;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    IsGreaterLeap(
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            base,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            relative)
+    {
+        return base.index > relative.index;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    IsNotGreaterLeap(
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            base,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            relative)
+    {
+        return base.index <= relative.index;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    IsNotLesserLeap(
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            base,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            relative)
+    {
+        return base.index >= relative.index;
+    }
+
+    // Returns true if the node at the index is reached from the nearest
+    // recorded node at or before it in fewer steps than the specified
+    // number of steps.
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Leaps(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Natural>
+            index,
+        Referential<const Natural>
+            steps)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural entry;
+        if (!space.count)
+            return false;
+        entry = index / space.interval;
+        if (entry >= space.count)
+            entry = space.count - 1;
+        return index - entry * space.interval < steps;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline Referential<const Saltant<Connective, Natural, Elemental>>
+    BeginReadIncrementLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<Saltant<Connective, Natural, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        position.at = Leap(space, count);
+        position.index = count;
+        if (position.at)
+            PrefetchRead<Nodal<Connective, Elemental>>(GetNext(position.at));
+        return position;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline Referential<const DoublySaltant<Natural, Elemental>>
+    BeginReadDecrementLeap(
+        Referential<const DoublySaltatory<Natural, Elemental>>
+            space,
+        Referential<DoublySaltant<Natural, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (count >= space.list->count) {
+            position.at = 0;
+            return position;
+        }
+        position.index = space.list->count - count - 1;
+        position.at = Leap(space, position.index);
+        PrefetchRead<DoublyNodal<Elemental>>(GetPrevious(position.at));
+        return position;
+    }
+
+    // Leaps from the nearest recorded node when that takes fewer steps
+    // than walking from the position.
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline Referential<const Saltant<Connective, Natural, Elemental>>
+    TraverseReadIncrementLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<Saltant<Connective, Natural, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        NodeLocational current;
+        Natural index;
+        if (count >= space.list->count - position.index) {
+            position.at = 0;
+            return position;
+        }
+        index = position.index + count;
+        if (Leaps(space, index, count)) {
+            current = Leap(space, index);
+        } else {
+            current = position.at;
+            for (Natural step = 0; step < count; step++)
+                current = GetNext(current);
+        }
+        PrefetchRead<Nodal<Connective, Elemental>>(GetNext(current));
+        position.at = current;
+        position.index = index;
+        return position;
+    }
+
+    // Leaps from the nearest recorded node when that takes fewer steps
+    // than walking back from the position.
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline Referential<const DoublySaltant<Natural, Elemental>>
+    TraverseReadDecrementLeap(
+        Referential<const DoublySaltatory<Natural, Elemental>>
+            space,
+        Referential<DoublySaltant<Natural, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        NodeLocational current;
+        Natural index;
+        if (count > position.index) {
+            position.at = 0;
+            return position;
+        }
+        index = position.index - count;
+        if (Leaps(space, index, count)) {
+            current = Leap(space, index);
+        } else {
+            current = position.at;
+            for (Natural step = 0; step < count; step++)
+                current = GetPrevious(current);
+        }
+        PrefetchRead<DoublyNodal<Elemental>>(GetPrevious(current));
+        position.at = current;
+        position.index = index;
+        return position;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline Conferential<const Elemental>
+    GoReadLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            position)
+    {
+        using ::location::Deter;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static auto& DeterElement = Deter<Elemental>;
+        return DeterElement(position.at->element);
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    BeginsLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return count < space.list->count;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    TraversesIncrementLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position.at && count < space.list->count - position.index;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    TraversesDecrementLeap(
+        Referential<const DoublySaltatory<Natural, Elemental>>
+            space,
+        Referential<const DoublySaltant<Natural, Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position.at && count <= position.index;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    ContainsLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position.at && Leap(space, position.index) == position.at;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline Natural
+    AccountLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return space.list->count;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    static inline Natural
+    CountIncrementLeap(
+        Referential<const Saltatory<Connective, Natural, Elemental>>
+            space,
+        Referential<const Saltant<Connective, Natural, Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return space.list->count - position.index - 1;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline Natural
+    CountDecrementLeap(
+        Referential<const DoublySaltatory<Natural, Elemental>>
+            space,
+        Referential<const DoublySaltant<Natural, Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position.index;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<const SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementSingleScale = {
+            SingleComparison<Elemental>,
+            BeginReadScale<SinglyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            TraverseReadScale<SinglyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            GoRead<SinglyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementDoubleScale = {
+            DoubleComparison<Elemental>,
+            BeginReadScale<DoublyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            TraverseReadScale<DoublyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            GoRead<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, Elemental>
+        WriteIncrementSingleScale = {
+            SingleComparison<Elemental>,
+            BeginWriteScale<SinglyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            TraverseWriteScale<SinglyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            GoWrite<SinglyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Elemental>
+        WriteIncrementDoubleScale = {
+            DoubleComparison<Elemental>,
+            BeginWriteScale<DoublyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            TraverseWriteScale<DoublyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            GoWrite<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>
+        ReadDecrementDoubleScale = {
+            DoubleComparison<Elemental>,
+            BeginReadScale<DoublyLinked<Elemental>, Natural, Elemental, GetLast<Natural, Elemental>, GetPrevious<Elemental>>,
+            TraverseReadScale<DoublyLinked<Elemental>, Natural, Elemental, GetPrevious<Elemental>>,
+            GoRead<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Elemental>
+        WriteDecrementDoubleScale = {
+            DoubleComparison<Elemental>,
+            BeginWriteScale<DoublyLinked<Elemental>, Natural, Elemental, GetLast<Natural, Elemental>, GetPrevious<Elemental>>,
+            TraverseWriteScale<DoublyLinked<Elemental>, Natural, Elemental, GetPrevious<Elemental>>,
+            GoWrite<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Lineal<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>
+        ReadDoubleLiner = {
+            ReadIncrementDoubleScale<Natural, Elemental>,
+            ReadDecrementDoubleScale<Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Lineal<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Elemental>
+        WriteDoubleLiner = {
+            WriteIncrementDoubleScale<Natural, Elemental>,
+            WriteDecrementDoubleScale<Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<const SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementSingleDirection = {
+            ReadIncrementSingleScale<Natural, Elemental>,
+            DirectionBegins<SinglyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            DirectionTraverses<SinglyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            Contains<SinglyLinked<Elemental>, Natural, Elemental>,
+            Account<SinglyLinked<Elemental>, Natural, Elemental>,
+            Count<SinglyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementDoubleDirection = {
+            ReadIncrementDoubleScale<Natural, Elemental>,
+            DirectionBegins<DoublyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            DirectionTraverses<DoublyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            Contains<DoublyLinked<Elemental>, Natural, Elemental>,
+            Account<DoublyLinked<Elemental>, Natural, Elemental>,
+            Count<DoublyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, Elemental>
+        WriteIncrementSingleDirection = {
+            WriteIncrementSingleScale<Natural, Elemental>,
+            DirectionBegins<SinglyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            DirectionTraverses<SinglyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            Contains<SinglyLinked<Elemental>, Natural, Elemental>,
+            Account<SinglyLinked<Elemental>, Natural, Elemental>,
+            Count<SinglyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Elemental>
+        WriteIncrementDoubleDirection = {
+            WriteIncrementDoubleScale<Natural, Elemental>,
+            DirectionBegins<DoublyLinked<Elemental>, Natural, Elemental, GetFirst<Natural, Elemental>, GetNext<Elemental>>,
+            DirectionTraverses<DoublyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>,
+            Contains<DoublyLinked<Elemental>, Natural, Elemental>,
+            Account<DoublyLinked<Elemental>, Natural, Elemental>,
+            Count<DoublyLinked<Elemental>, Natural, Elemental, GetNext<Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>
+        ReadDecrementDoubleDirection = {
+            ReadDecrementDoubleScale<Natural, Elemental>,
+            DirectionBegins<DoublyLinked<Elemental>, Natural, Elemental, GetLast<Natural, Elemental>, GetPrevious<Elemental>>,
+            DirectionTraverses<DoublyLinked<Elemental>, Natural, Elemental, GetPrevious<Elemental>>,
+            Contains<DoublyLinked<Elemental>, Natural, Elemental>,
+            Account<DoublyLinked<Elemental>, Natural, Elemental>,
+            Count<DoublyLinked<Elemental>, Natural, Elemental, GetPrevious<Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Elemental>
+        WriteDecrementDoubleDirection = {
+            WriteDecrementDoubleScale<Natural, Elemental>,
+            DirectionBegins<DoublyLinked<Elemental>, Natural, Elemental, GetLast<Natural, Elemental>, GetPrevious<Elemental>>,
+            DirectionTraverses<DoublyLinked<Elemental>, Natural, Elemental, GetPrevious<Elemental>>,
+            Contains<DoublyLinked<Elemental>, Natural, Elemental>,
+            Account<DoublyLinked<Elemental>, Natural, Elemental>,
+            Count<DoublyLinked<Elemental>, Natural, Elemental, GetPrevious<Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Axial<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>
+        ReadDoubleAxis = {
+            ReadIncrementDoubleDirection<Natural, Elemental>,
+            ReadDecrementDoubleDirection<Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Axial<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Elemental>
+        WriteDoubleAxis = {
+            WriteIncrementDoubleDirection<Natural, Elemental>,
+            WriteDecrementDoubleDirection<Natural, Elemental>
+        };
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    constexpr Equative<Saltant<Connective, Natural, Elemental>>
+        LeapEquality = {
+            IsEqualLeap<Connective, Natural, Elemental>,
+            IsNotEqualLeap<Connective, Natural, Elemental>
+        };
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    constexpr Relational<Saltant<Connective, Natural, Elemental>>
+        LeapRelation = {
+            IsLesserLeap<Connective, Natural, Elemental>,
+            IsGreaterLeap<Connective, Natural, Elemental>,
+            IsNotGreaterLeap<Connective, Natural, Elemental>,
+            IsNotLesserLeap<Connective, Natural, Elemental>
+        };
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    constexpr Comparative<Saltant<Connective, Natural, Elemental>>
+        LeapComparison = {
+            LeapEquality<Connective, Natural, Elemental>,
+            LeapRelation<Connective, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<const SinglySaltatory<Natural, Elemental>, SinglySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadIncrementSingleLeap = {
+            LeapComparison<SinglyLinked<Elemental>, Natural, Elemental>,
+            BeginReadIncrementLeap<SinglyLinked<Elemental>, Natural, Elemental>,
+            TraverseReadIncrementLeap<SinglyLinked<Elemental>, Natural, Elemental>,
+            GoReadLeap<SinglyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<const DoublySaltatory<Natural, Elemental>, DoublySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadIncrementDoubleLeap = {
+            LeapComparison<DoublyLinked<Elemental>, Natural, Elemental>,
+            BeginReadIncrementLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            TraverseReadIncrementLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            GoReadLeap<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Scalar<const DoublySaltatory<Natural, Elemental>, DoublySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadDecrementDoubleLeap = {
+            LeapComparison<DoublyLinked<Elemental>, Natural, Elemental>,
+            BeginReadDecrementLeap<Natural, Elemental>,
+            TraverseReadDecrementLeap<Natural, Elemental>,
+            GoReadLeap<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Lineal<const DoublySaltatory<Natural, Elemental>, DoublySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadDoubleLeapLiner = {
+            ReadIncrementDoubleLeap<Natural, Elemental>,
+            ReadDecrementDoubleLeap<Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<const SinglySaltatory<Natural, Elemental>, SinglySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadIncrementSingleLeapDirection = {
+            ReadIncrementSingleLeap<Natural, Elemental>,
+            BeginsLeap<SinglyLinked<Elemental>, Natural, Elemental>,
+            TraversesIncrementLeap<SinglyLinked<Elemental>, Natural, Elemental>,
+            ContainsLeap<SinglyLinked<Elemental>, Natural, Elemental>,
+            AccountLeap<SinglyLinked<Elemental>, Natural, Elemental>,
+            CountIncrementLeap<SinglyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<const DoublySaltatory<Natural, Elemental>, DoublySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadIncrementDoubleLeapDirection = {
+            ReadIncrementDoubleLeap<Natural, Elemental>,
+            BeginsLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            TraversesIncrementLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            ContainsLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            AccountLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            CountIncrementLeap<DoublyLinked<Elemental>, Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Directional<const DoublySaltatory<Natural, Elemental>, DoublySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadDecrementDoubleLeapDirection = {
+            ReadDecrementDoubleLeap<Natural, Elemental>,
+            BeginsLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            TraversesDecrementLeap<Natural, Elemental>,
+            ContainsLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            AccountLeap<DoublyLinked<Elemental>, Natural, Elemental>,
+            CountDecrementLeap<Natural, Elemental>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental>
+    constexpr Axial<const DoublySaltatory<Natural, Elemental>, DoublySaltant<Natural, Elemental>, Natural, const Elemental>
+        ReadDoubleLeapAxis = {
+            ReadIncrementDoubleLeapDirection<Natural, Elemental>,
+            ReadDecrementDoubleLeapDirection<Natural, Elemental>
+        };
+
+}
+
+}
+
+#endif
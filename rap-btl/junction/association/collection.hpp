@@ -18,13 +18,19 @@ namespace association {
      */
     namespace collection {
 
+        using ::association::Deferrable;
         using ::junction::consecution::Cede;
+        using ::junction::consecution::CedeDeferent;
         using ::junction::consecution::Concede;
         using ::junction::consecution::Concessive;
         using ::junction::consecution::Consequent;
+        using ::junction::consecution::DeferredConsequent;
+        using ::junction::consecution::DeferredPrecedent;
         using ::junction::consecution::Precede;
+        using ::junction::consecution::PrecedeDeferent;
         using ::junction::consecution::Precedent;
         using ::junction::consecution::Proceed;
+        using ::junction::consecution::ProceedDeferent;
         using ::sortation::Assortive;
         using ::sortation::SearchBisection;
         using ::sortation::SearchBisectionIteratively;
@@ -87,23 +93,32 @@ namespace association {
             return SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order);
         }
 
+        // Associations are shared between the copying and deferring
+        // functions, which differ only in whether the relator and value are
+        // copied or moved into the pair inserted into the map.  The pair is
+        // only built once the insertion point is found, so that rejected
+        // arguments are left intact.
         template <
             typename Natural,
             typename Correlative,
             typename Evaluative,
-            Referential<Precedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Precede,
-            Referential<Precedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Cede,
-            Referential<Consequent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Proceed,
+            typename Precedential,
+            typename Consequential,
+            Referential<Precedential> Precede,
+            Referential<Precedential> Cede,
+            Referential<Consequential> Proceed,
             Referential<Assortive<Correlative>> Equate,
             Referential<Assortive<Correlative>> Order,
-            Referential<const Scalar<const AssociativelySingleJunctive<Natural, Correlative, Evaluative>, AssociativelySinglePositional<Correlative, Evaluative>, Natural, const Correlative>> Scale>
+            Referential<const Scalar<const AssociativelySingleJunctive<Natural, Correlative, Evaluative>, AssociativelySinglePositional<Correlative, Evaluative>, Natural, const Correlative>> Scale,
+            typename Relational,
+            typename Valuable>
         static inline bool
-        Associate(
+        AssociateValue(
             Referential<AssociativelySingleJunctive<Natural, Correlative, Evaluative>>
                 map,
-            Referential<const Correlative>
+            Deferential<Relational>
                 relator,
-            Referential<const Evaluative>
+            Deferential<Valuable>
                 value)
         {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -114,31 +129,30 @@ namespace association {
 #endif
             using MapComplementary = Complementary<Correlative, Evaluative>;
             using MapPositional = AssociativelySinglePositional<Correlative, Evaluative>;
-            const MapComplementary pair = { relator, value };
             MapPositional position;
             if (!map.first)
-                return Proceed(map, pair);
+                return Proceed(map, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
             Scale.begin(map, position, 0);
             if (SearchScalarBisection(map, Scale, relator, position, (Natural) (Account(map) - 1), Equate, Order))
                 return false;
             if (Order(Scale.go(map, position).to, relator))
-                return Cede(map, position, pair);
-            return Precede(map, position, pair);
+                return Cede(map, position, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
+            return Precede(map, position, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
         }
 
         template <
             typename Natural,
             typename Correlative,
             typename Evaluative,
-            Referential<Precedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Precede,
-            Referential<Precedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Cede,
-            Referential<Consequent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Precedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<Precedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<Consequent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Proceed,
             Referential<Assortive<Correlative>> Equate,
             Referential<Assortive<Correlative>> Order,
-            Referential<const Lineal<const AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>, AssociativelyDoublePositional<Correlative, Evaluative>, Natural, const Correlative>> Liner>
+            Referential<const Scalar<const AssociativelySingleJunctive<Natural, Correlative, Evaluative>, AssociativelySinglePositional<Correlative, Evaluative>, Natural, const Correlative>> Scale>
         static inline bool
         Associate(
-            Referential<AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>>
+            Referential<AssociativelySingleJunctive<Natural, Correlative, Evaluative>>
                 map,
             Referential<const Correlative>
                 relator,
@@ -150,20 +164,135 @@ namespace association {
             static_assert(
                 is_integral<Natural>::value && is_unsigned<Natural>::value,
                 "Natural:  Unsigned integer type required");
+#endif
+            return AssociateValue<Natural, Correlative, Evaluative, Precedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, Consequent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, Precede, Cede, Proceed, Equate, Order, Scale>(map, relator, value);
+        }
+
+        template <
+            typename Natural,
+            typename Correlative,
+            typename Evaluative,
+            Referential<DeferredPrecedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<DeferredPrecedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<DeferredConsequent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Scalar<const AssociativelySingleJunctive<Natural, Correlative, Evaluative>, AssociativelySinglePositional<Correlative, Evaluative>, Natural, const Correlative>> Scale>
+        static inline bool
+        AssociateDeferent(
+            Referential<AssociativelySingleJunctive<Natural, Correlative, Evaluative>>
+                map,
+            Deferential<Correlative>
+                relator,
+            Deferential<Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return AssociateValue<Natural, Correlative, Evaluative, DeferredPrecedent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, DeferredConsequent<SingleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, Precede, Cede, Proceed, Equate, Order, Scale>(map, static_cast<Deferential<Correlative>>(relator), static_cast<Deferential<Evaluative>>(value));
+        }
+
+        template <
+            typename Natural,
+            typename Correlative,
+            typename Evaluative,
+            typename Precedential,
+            typename Consequential,
+            Referential<Precedential> Precede,
+            Referential<Precedential> Cede,
+            Referential<Consequential> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>, AssociativelyDoublePositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            typename Relational,
+            typename Valuable>
+        static inline bool
+        AssociateValue(
+            Referential<AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>>
+                map,
+            Deferential<Relational>
+                relator,
+            Deferential<Valuable>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
 #endif
             using MapComplementary = Complementary<Correlative, Evaluative>;
             using MapPositional = AssociativelyDoublePositional<Correlative, Evaluative>;
             static const Natural Before = 0;
-            const MapComplementary pair = { relator, value };
             MapPositional position;
             if (!map.first)
-                return Proceed(map, pair);
+                return Proceed(map, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
             Liner.increment.begin(map, position, 0);
             if (SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order))
                 return false;
             if (Order(Liner.increment.go(map, position).to, relator))
-                return Cede(map, position, pair);
-            return Precede(map, position, pair);
+                return Cede(map, position, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
+            return Precede(map, position, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
+        }
+
+        template <
+            typename Natural,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Precedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<Precedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<Consequent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>, AssociativelyDoublePositional<Correlative, Evaluative>, Natural, const Correlative>> Liner>
+        static inline bool
+        Associate(
+            Referential<AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator,
+            Referential<const Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return AssociateValue<Natural, Correlative, Evaluative, Precedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, Consequent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, Precede, Cede, Proceed, Equate, Order, Liner>(map, relator, value);
+        }
+
+        template <
+            typename Natural,
+            typename Correlative,
+            typename Evaluative,
+            Referential<DeferredPrecedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<DeferredPrecedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<DeferredConsequent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>, AssociativelyDoublePositional<Correlative, Evaluative>, Natural, const Correlative>> Liner>
+        static inline bool
+        AssociateDeferent(
+            Referential<AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>>
+                map,
+            Deferential<Correlative>
+                relator,
+            Deferential<Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return AssociateValue<Natural, Correlative, Evaluative, DeferredPrecedent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, DeferredConsequent<DoubleComplementary<Correlative, Evaluative>, Natural, Complementary<Correlative, Evaluative>>, Precede, Cede, Proceed, Equate, Order, Liner>(map, static_cast<Deferential<Correlative>>(relator), static_cast<Deferential<Evaluative>>(value));
         }
 
         template <
@@ -417,6 +546,30 @@ namespace association {
                 DeleteOneNode<Natural, Complementary<Correlative, Evaluative>, Adjunct>
             };
 
+        template <
+            typename Natural,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const AssociativelySingleAdjunctive<Natural, Correlative, Evaluative>> Adjunct>
+        constexpr Deferrable<AssociativelySingleJunctive<Natural, Correlative, Evaluative>, Correlative, Evaluative>
+            SingleDeferrer = {
+                AssociateDeferent<Natural, Correlative, Evaluative, PrecedeDeferent<Natural, Complementary<Correlative, Evaluative>, Adjunct>, CedeDeferent<Natural, Complementary<Correlative, Evaluative>, Adjunct>, ProceedDeferent<Natural, Complementary<Correlative, Evaluative>, Adjunct>, Equate, Order, ReadRelatorIncrementSingleScale<Natural, Correlative, Evaluative>>
+            };
+
+        template <
+            typename Natural,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const AssociativelyDoubleAdjunctive<Natural, Correlative, Evaluative>> Adjunct>
+        constexpr Deferrable<AssociativelyDoubleJunctive<Natural, Correlative, Evaluative>, Correlative, Evaluative>
+            DoubleDeferrer = {
+                AssociateDeferent<Natural, Correlative, Evaluative, PrecedeDeferent<Natural, Complementary<Correlative, Evaluative>, Adjunct>, CedeDeferent<Natural, Complementary<Correlative, Evaluative>, Adjunct>, ProceedDeferent<Natural, Complementary<Correlative, Evaluative>, Adjunct>, Equate, Order, ReadRelatorDoubleLiner<Natural, Correlative, Evaluative>>
+            };
+
     }
 
 }
@@ -3,6 +3,7 @@
 #ifndef SAFE_JUNCTION_ASSOCIATION_COLLECTION_MODULE
 #define SAFE_JUNCTION_ASSOCIATION_COLLECTION_MODULE
 #include <junction/association/collection.hpp>
+#include <junction/association/safe.hpp>
 #include <junction/consecution/safe.hpp>
 
 namespace junction {
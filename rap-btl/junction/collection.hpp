@@ -19,14 +19,20 @@ namespace collection {
     using ::collection::Collective;
     using ::collection::EquateCollections;
     using ::composition::Compositional;
+    using ::composition::Deferrable;
     using ::consecution::ConjointlyConsequent;
     using ::junction::consecution::Cede;
+    using ::junction::consecution::CedeDeferent;
     using ::junction::consecution::Concede;
     using ::junction::consecution::Concessive;
     using ::junction::consecution::Consequent;
+    using ::junction::consecution::DeferredConsequent;
+    using ::junction::consecution::DeferredPrecedent;
     using ::junction::consecution::Precede;
+    using ::junction::consecution::PrecedeDeferent;
     using ::junction::consecution::Precedent;
     using ::junction::consecution::Proceed;
+    using ::junction::consecution::ProceedDeferent;
     using ::selection::EquateSelections;
     using ::selection::Sectional;
     using ::selection::Selective;
@@ -89,20 +95,26 @@ namespace collection {
         return SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order);
     }
 
+    // Compositions are shared between the copying and deferring functions,
+    // which differ only in whether the value is copied or moved into the
+    // position found for it.
     template <
         typename Natural,
         typename Elemental,
-        Referential<Precedent<SinglyLinked<Elemental>, Natural, Elemental>> Precede,
-        Referential<Precedent<SinglyLinked<Elemental>, Natural, Elemental>> Cede,
-        Referential<Consequent<SinglyLinked<Elemental>, Natural, Elemental>> Proceed,
+        typename Precedential,
+        typename Consequential,
+        Referential<Precedential> Precede,
+        Referential<Precedential> Cede,
+        Referential<Consequential> Proceed,
         Referential<Assortive<Elemental>> Equate,
         Referential<Assortive<Elemental>> Order,
-        Referential<const Scalar<const SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, const Elemental>> Scale>
+        Referential<const Scalar<const SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, const Elemental>> Scale,
+        typename Valuable>
     static inline bool
-    ComposeCollection(
+    ComposeCollectionValue(
         Referential<SinglyJunctive<Natural, Elemental>>
             set,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -113,27 +125,27 @@ namespace collection {
 #endif
         SinglyPositional<Elemental> position;
         if (!set.first)
-            return Proceed(set, value);
+            return Proceed(set, static_cast<Deferential<Valuable>>(value));
         Scale.begin(set, position, 0);
         if (SearchScalarBisection(set, Scale, value, position, (Natural) (Account(set) - 1), Equate, Order))
             return false;
         if (Order(Scale.go(set, position).to, value))
-            return Cede(set, position, value);
-        return Precede(set, position, value);
+            return Cede(set, position, static_cast<Deferential<Valuable>>(value));
+        return Precede(set, position, static_cast<Deferential<Valuable>>(value));
     }
 
     template <
         typename Natural,
         typename Elemental,
-        Referential<Precedent<DoublyLinked<Elemental>, Natural, Elemental>> Precede,
-        Referential<Precedent<DoublyLinked<Elemental>, Natural, Elemental>> Cede,
-        Referential<Consequent<DoublyLinked<Elemental>, Natural, Elemental>> Proceed,
+        Referential<Precedent<SinglyLinked<Elemental>, Natural, Elemental>> Precede,
+        Referential<Precedent<SinglyLinked<Elemental>, Natural, Elemental>> Cede,
+        Referential<Consequent<SinglyLinked<Elemental>, Natural, Elemental>> Proceed,
         Referential<Assortive<Elemental>> Equate,
         Referential<Assortive<Elemental>> Order,
-        Referential<const Lineal<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>> Liner>
+        Referential<const Scalar<const SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, const Elemental>> Scale>
     static inline bool
     ComposeCollection(
-        Referential<DoublyJunctive<Natural, Elemental>>
+        Referential<SinglyJunctive<Natural, Elemental>>
             set,
         Referential<const Elemental>
             value)
@@ -143,17 +155,120 @@ namespace collection {
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
+#endif
+        return ComposeCollectionValue<Natural, Elemental, Precedent<SinglyLinked<Elemental>, Natural, Elemental>, Consequent<SinglyLinked<Elemental>, Natural, Elemental>, Precede, Cede, Proceed, Equate, Order, Scale>(set, value);
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<DeferredPrecedent<SinglyLinked<Elemental>, Natural, Elemental>> Precede,
+        Referential<DeferredPrecedent<SinglyLinked<Elemental>, Natural, Elemental>> Cede,
+        Referential<DeferredConsequent<SinglyLinked<Elemental>, Natural, Elemental>> Proceed,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const Scalar<const SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Natural, const Elemental>> Scale>
+    static inline bool
+    ComposeCollectionDeferent(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            set,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ComposeCollectionValue<Natural, Elemental, DeferredPrecedent<SinglyLinked<Elemental>, Natural, Elemental>, DeferredConsequent<SinglyLinked<Elemental>, Natural, Elemental>, Precede, Cede, Proceed, Equate, Order, Scale>(set, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        typename Precedential,
+        typename Consequential,
+        Referential<Precedential> Precede,
+        Referential<Precedential> Cede,
+        Referential<Consequential> Proceed,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const Lineal<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>> Liner,
+        typename Valuable>
+    static inline bool
+    ComposeCollectionValue(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            set,
+        Deferential<Valuable>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
 #endif
         static const Natural Before = 0;
         DoublyPositional<Elemental> position;
         if (!set.first)
-            return Proceed(set, value);
+            return Proceed(set, static_cast<Deferential<Valuable>>(value));
         Liner.increment.begin(set, position, 0);
         if (SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order))
             return false;
         if (Order(Liner.increment.go(set, position).to, value))
-            return Cede(set, position, value);
-        return Precede(set, position, value);
+            return Cede(set, position, static_cast<Deferential<Valuable>>(value));
+        return Precede(set, position, static_cast<Deferential<Valuable>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<Precedent<DoublyLinked<Elemental>, Natural, Elemental>> Precede,
+        Referential<Precedent<DoublyLinked<Elemental>, Natural, Elemental>> Cede,
+        Referential<Consequent<DoublyLinked<Elemental>, Natural, Elemental>> Proceed,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const Lineal<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>> Liner>
+    static inline bool
+    ComposeCollection(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            set,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ComposeCollectionValue<Natural, Elemental, Precedent<DoublyLinked<Elemental>, Natural, Elemental>, Consequent<DoublyLinked<Elemental>, Natural, Elemental>, Precede, Cede, Proceed, Equate, Order, Liner>(set, value);
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<DeferredPrecedent<DoublyLinked<Elemental>, Natural, Elemental>> Precede,
+        Referential<DeferredPrecedent<DoublyLinked<Elemental>, Natural, Elemental>> Cede,
+        Referential<DeferredConsequent<DoublyLinked<Elemental>, Natural, Elemental>> Proceed,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const Lineal<const DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, const Elemental>> Liner>
+    static inline bool
+    ComposeCollectionDeferent(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            set,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ComposeCollectionValue<Natural, Elemental, DeferredPrecedent<DoublyLinked<Elemental>, Natural, Elemental>, DeferredConsequent<DoublyLinked<Elemental>, Natural, Elemental>, Precede, Cede, Proceed, Equate, Order, Liner>(set, static_cast<Deferential<Elemental>>(value));
     }
 
     template <
@@ -1728,6 +1843,44 @@ namespace collection {
             DeleteOneNode<Natural, Elemental, Adjunct>
         };
 
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    constexpr Deferrable<SinglyJunctive<Natural, Elemental>, Elemental>
+        OrderedSingleDeferrer = {
+            ComposeCollectionDeferent<
+                Natural,
+                Elemental,
+                PrecedeDeferent<Natural, Elemental, Adjunct>,
+                CedeDeferent<Natural, Elemental, Adjunct>,
+                ProceedDeferent<Natural, Elemental, Adjunct>,
+                Equate,
+                Order,
+                ReadIncrementSingleScale<Natural, Elemental>>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    constexpr Deferrable<DoublyJunctive<Natural, Elemental>, Elemental>
+        OrderedDoubleDeferrer = {
+            ComposeCollectionDeferent<
+                Natural,
+                Elemental,
+                PrecedeDeferent<Natural, Elemental, Adjunct>,
+                CedeDeferent<Natural, Elemental, Adjunct>,
+                ProceedDeferent<Natural, Elemental, Adjunct>,
+                Equate,
+                Order,
+                ReadDoubleLiner<Natural, Elemental>>
+        };
+
     template <
         typename Basic,
         typename BasicPositional,
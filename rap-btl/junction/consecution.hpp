@@ -16,6 +16,7 @@ namespace junction {
 namespace consecution {
 
     using ::consecution::Conjoint;
+    using ::consecution::Deferrable;
     using ::consecution::Sequent;
 
     /**
@@ -67,6 +68,56 @@ namespace consecution {
         Referential<const Elemental>
             value);
 
+    /**
+     * @brief 
+     *     Function abstract used to move an element to either pole.
+     * @details  
+     *     This function type alias is used to declare function references 
+     *     which move one element either before the first or after the last 
+     *     node in the linked list.
+     * @tparam Connective
+     *     Type of the node linkage.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    using DeferredConsequent = bool(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            sequence,
+        Deferential<Elemental>
+            value);
+
+    /**
+     * @brief 
+     *     Function abstract used to move an element beside a position.
+     * @details  
+     *     This function type alias is used to declare function references 
+     *     which move one element either before or after the provided 
+     *     position.
+     * @tparam Connective
+     *     Type of the node linkage.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     */
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental>
+    using DeferredPrecedent = bool(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            sequence,
+        Referential<const Positional<Connective, Elemental>>
+            rank,
+        Deferential<Elemental>
+            value);
+
     /**
      * @brief 
      *     Function abstract used to remove elements from either pole.
@@ -195,15 +246,19 @@ namespace consecution {
         return finalize(first, last, count);
     }
 
+    // Insertions of a single element are shared between the copying and
+    // deferring functions, which differ only in whether the node is
+    // proclaimed with a copy of the value or has the value moved into it.
     template <
         typename Natural,
         typename Elemental,
-        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Accede(
+    AccedeValue(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -214,7 +269,7 @@ namespace consecution {
 #endif
         using NodeLocational = Locational<SinglyNodal<Elemental>>;
         NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
+        result = ProclaimValue<SinglyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
         if (!result)
             return false;
         SetNext(result, sequence.first);
@@ -228,12 +283,13 @@ namespace consecution {
     template <
         typename Natural,
         typename Elemental,
-        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Accede(
+    AccedeValue(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -244,7 +300,7 @@ namespace consecution {
 #endif
         using NodeLocational = Locational<DoublyNodal<Elemental>>;
         NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
+        result = ProclaimValue<DoublyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
         if (!result)
             return false;
         UnsetPrevious(result);
@@ -259,107 +315,17 @@ namespace consecution {
     }
 
     template <
-        typename Relative,
-        typename Appositional,
-        typename RelativeNatural,
         typename Natural,
         typename Elemental,
         Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
-        const bool Safety>
-    static inline bool
-    Accede(
-        Referential<SinglyJunctive<Natural, Elemental>>
-            sequence,
-        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
-            direction,
-        Referential<const Relative>
-            space,
-        Referential<const Appositional>
-            from,
-        Referential<const Appositional>
-            to)
-    {
-#ifndef RAPBTL_NO_STD_CPLUSPLUS
-        using namespace ::std;
-        static_assert(
-            is_integral<Natural>::value && is_unsigned<Natural>::value,
-            "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
-#endif
-        using NodeLocational = Locational<SinglyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
-        NodeLocational first, last;
-        Natural length;
-        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-            return false;
-        SetNext(last, sequence.first);
-        if (!sequence.first)
-            sequence.last = last;
-        sequence.first = first;
-        sequence.count += length;
-        return true;
-    }
-
-    template <
-        typename Relative,
-        typename Appositional,
-        typename RelativeNatural,
-        typename Natural,
-        typename Elemental,
-        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
-        const bool Safety>
-    static inline bool
-    Accede(
-        Referential<DoublyJunctive<Natural, Elemental>>
-            sequence,
-        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
-            direction,
-        Referential<const Relative>
-            space,
-        Referential<const Appositional>
-            from,
-        Referential<const Appositional>
-            to)
-    {
-#ifndef RAPBTL_NO_STD_CPLUSPLUS
-        using namespace ::std;
-        static_assert(
-            is_integral<Natural>::value && is_unsigned<Natural>::value,
-            "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
-#endif
-        using NodeLocational = Locational<DoublyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
-        NodeLocational first, last;
-        Natural length;
-        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-            return false;
-        UnsetPrevious(first);
-        SetNext(last, sequence.first);
-        if (sequence.first)
-            SetPrevious(sequence.first, last);
-        else
-            sequence.last = last;
-        sequence.first = first;
-        sequence.count += length;
-        return true;
-    }
-
-    template <
-        typename Natural,
-        typename Elemental,
-        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+        typename Valuable>
     static inline bool
-    Precede(
+    PrecedeValue(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
         Referential<const SinglyPositional<Elemental>>
             rank,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -372,14 +338,14 @@ namespace consecution {
         NodeLocational result, previous;
         previous = sequence.first;
         if (previous == rank.at) {
-            result = Adjunct.proclaim(sequence, value);
+            result = ProclaimValue<SinglyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
             if (!result)
                 return false;
             sequence.first = result;
         } else {
             while (GetNext(previous) != rank.at)
                 previous = GetNext(previous);
-            result = Adjunct.proclaim(sequence, value);
+            result = ProclaimValue<SinglyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
             if (!result)
                 return false;
             SetNext(previous, result);
@@ -392,14 +358,15 @@ namespace consecution {
     template <
         typename Natural,
         typename Elemental,
-        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Precede(
+    PrecedeValue(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
         Referential<const DoublyPositional<Elemental>>
             rank,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -410,7 +377,7 @@ namespace consecution {
 #endif
         using NodeLocational = Locational<DoublyNodal<Elemental>>;
         NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
+        result = ProclaimValue<DoublyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
         if (!result)
             return false;
         if (GetPrevious(rank.at))
@@ -425,116 +392,84 @@ namespace consecution {
     }
 
     template <
-        typename Relative,
-        typename Appositional,
-        typename RelativeNatural,
         typename Natural,
         typename Elemental,
-        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Precede(
+    CedeValue(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
         Referential<const SinglyPositional<Elemental>>
             rank,
-        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
-            direction,
-        Referential<const Relative>
-            space,
-        Referential<const Appositional>
-            from,
-        Referential<const Appositional>
-            to)
+        Deferential<Valuable>
+            value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
         using namespace ::std;
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
 #endif
         using NodeLocational = Locational<SinglyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
-        NodeLocational first, last, previous;
-        Natural length;
-        previous = sequence.first;
-        if (previous == rank.at) {
-            if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-                return false;
-            sequence.first = first;
-        } else {
-            while (GetNext(previous) != rank.at)
-                previous = GetNext(previous);
-            if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-                return false;
-            SetNext(previous, first);
-        }
-        SetNext(last, rank.at);
-        sequence.count += length;
+        NodeLocational result;
+        result = ProclaimValue<SinglyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
+        if (!result)
+            return false;
+        SetNext(result, GetNext(rank.at));
+        SetNext(rank.at, result);
+        if (!GetNext(result))
+            sequence.last = result;
+        sequence.count++;
         return true;
     }
 
     template <
-        typename Relative,
-        typename Appositional,
-        typename RelativeNatural,
         typename Natural,
         typename Elemental,
-        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Precede(
+    CedeValue(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
         Referential<const DoublyPositional<Elemental>>
             rank,
-        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
-            direction,
-        Referential<const Relative>
-            space,
-        Referential<const Appositional>
-            from,
-        Referential<const Appositional>
-            to)
+        Deferential<Valuable>
+            value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
         using namespace ::std;
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
 #endif
         using NodeLocational = Locational<DoublyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
-        NodeLocational first, last;
-        Natural length;
-        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+        NodeLocational result;
+        result = ProclaimValue<DoublyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
+        if (!result)
             return false;
-        SetPrevious(first, GetPrevious(rank.at));
-        if (GetPrevious(first))
-            SetNext(GetPrevious(first), first);
+        SetNext(result, GetNext(rank.at));
+        SetPrevious(result, rank.at);
+        SetNext(rank.at, result);
+        if (GetNext(result))
+            SetPrevious(GetNext(result), result);
         else
-            sequence.first = first;
-        SetNext(last, rank.at);
-        SetPrevious(rank.at, last);
-        sequence.count += length;
+            sequence.last = result;
+        sequence.count++;
         return true;
     }
 
     template <
         typename Natural,
         typename Elemental,
-        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Cede(
+    ProceedValue(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const SinglyPositional<Elemental>>
-            rank,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -545,13 +480,15 @@ namespace consecution {
 #endif
         using NodeLocational = Locational<SinglyNodal<Elemental>>;
         NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
+        result = ProclaimValue<SinglyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
         if (!result)
             return false;
-        SetNext(result, GetNext(rank.at));
-        SetNext(rank.at, result);
-        if (!GetNext(result))
-            sequence.last = result;
+        UnsetNext(result);
+        if (sequence.last)
+            SetNext(sequence.last, result);
+        else
+            sequence.first = result;
+        sequence.last = result;
         sequence.count++;
         return true;
     }
@@ -559,14 +496,13 @@ namespace consecution {
     template <
         typename Natural,
         typename Elemental,
-        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
+        typename Valuable>
     static inline bool
-    Cede(
+    ProceedValue(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const DoublyPositional<Elemental>>
-            rank,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -577,33 +513,72 @@ namespace consecution {
 #endif
         using NodeLocational = Locational<DoublyNodal<Elemental>>;
         NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
+        result = ProclaimValue<DoublyLinked<Elemental>, Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Valuable>>(value));
         if (!result)
             return false;
-        SetNext(result, GetNext(rank.at));
-        SetPrevious(result, rank.at);
-        SetNext(rank.at, result);
-        if (GetNext(result))
-            SetPrevious(GetNext(result), result);
-        else
-            sequence.last = result;
+        SetPrevious(result, sequence.last);
+        UnsetNext(result);
+        if (sequence.last)
+            SetNext(sequence.last, result);
+        else
+            sequence.first = result;
+        sequence.last = result;
         sequence.count++;
         return true;
     }
 
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Accede(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return AccedeValue<Natural, Elemental, Adjunct>(sequence, value);
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Accede(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return AccedeValue<Natural, Elemental, Adjunct>(sequence, value);
+    }
+
     template <
         typename Relative,
         typename Appositional,
         typename RelativeNatural,
         typename Natural,
         typename Elemental,
-        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
+        const bool Safety>
     static inline bool
-    Cede(
+    Accede(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const SinglyPositional<Elemental>>
-            rank,
         Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
             direction,
         Referential<const Relative>
@@ -623,15 +598,15 @@ namespace consecution {
             "RelativeNatural:  Unsigned integer type required");
 #endif
         using NodeLocational = Locational<SinglyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
+        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
         NodeLocational first, last;
         Natural length;
         if (!SequenceList(sequence, first, last, length, direction, space, from, to))
             return false;
-        SetNext(last, GetNext(rank.at));
-        if (!GetNext(last))
+        SetNext(last, sequence.first);
+        if (!sequence.first)
             sequence.last = last;
-        SetNext(rank.at, first);
+        sequence.first = first;
         sequence.count += length;
         return true;
     }
@@ -640,11 +615,154 @@ namespace consecution {
         typename Relative,
         typename Appositional,
         typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
+        NodeLocational first, last;
+        Natural length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        UnsetPrevious(first);
+        SetNext(last, sequence.first);
+        if (sequence.first)
+            SetPrevious(sequence.first, last);
+        else
+            sequence.last = last;
+        sequence.first = first;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Precede(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return PrecedeValue<Natural, Elemental, Adjunct>(sequence, rank, value);
+    }
+
+    template <
         typename Natural,
         typename Elemental,
         Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
     static inline bool
-    Cede(
+    Precede(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return PrecedeValue<Natural, Elemental, Adjunct>(sequence, rank, value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Precede(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<SinglyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
+        NodeLocational first, last, previous;
+        Natural length;
+        previous = sequence.first;
+        if (previous == rank.at) {
+            if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+                return false;
+            sequence.first = first;
+        } else {
+            while (GetNext(previous) != rank.at)
+                previous = GetNext(previous);
+            if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+                return false;
+            SetNext(previous, first);
+        }
+        SetNext(last, rank.at);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Precede(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
         Referential<const DoublyPositional<Elemental>>
@@ -663,25 +781,423 @@ namespace consecution {
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
+        NodeLocational first, last;
+        Natural length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetPrevious(first, GetPrevious(rank.at));
+        if (GetPrevious(first))
+            SetNext(GetPrevious(first), first);
+        else
+            sequence.first = first;
+        SetNext(last, rank.at);
+        SetPrevious(rank.at, last);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Cede(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return CedeValue<Natural, Elemental, Adjunct>(sequence, rank, value);
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Cede(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return CedeValue<Natural, Elemental, Adjunct>(sequence, rank, value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Cede(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<SinglyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
+        NodeLocational first, last;
+        Natural length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetNext(last, GetNext(rank.at));
+        if (!GetNext(last))
+            sequence.last = last;
+        SetNext(rank.at, first);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Cede(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
+        NodeLocational first, last;
+        Natural length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        SetPrevious(first, rank.at);
+        SetNext(last, GetNext(rank.at));
+        if (GetNext(last))
+            SetPrevious(GetNext(last), last);
+        else
+            sequence.last = last;
+        SetNext(rank.at, first);
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Proceed(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ProceedValue<Natural, Elemental, Adjunct>(sequence, value);
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    Proceed(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ProceedValue<Natural, Elemental, Adjunct>(sequence, value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<SinglyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
+        NodeLocational first, last;
+        Natural length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        UnsetNext(last);
+        if (sequence.last)
+            SetNext(sequence.last, first);
+        else
+            sequence.first = first;
+        sequence.last = last;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
+        NodeLocational first, last;
+        Natural length;
+        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
+            return false;
+        UnsetNext(last);
+        SetPrevious(first, sequence.last);
+        if (sequence.last)
+            SetNext(sequence.last, first);
+        else
+            sequence.first = first;
+        sequence.last = last;
+        sequence.count += length;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    AccedeDeferent(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return AccedeValue<Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    AccedeDeferent(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return AccedeValue<Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    PrecedeDeferent(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return PrecedeValue<Natural, Elemental, Adjunct>(sequence, rank, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    PrecedeDeferent(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return PrecedeValue<Natural, Elemental, Adjunct>(sequence, rank, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    CedeDeferent(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return CedeValue<Natural, Elemental, Adjunct>(sequence, rank, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    static inline bool
+    CedeDeferent(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            sequence,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
 #endif
-        using NodeLocational = Locational<DoublyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, false>;
-        NodeLocational first, last;
-        Natural length;
-        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-            return false;
-        SetPrevious(first, rank.at);
-        SetNext(last, GetNext(rank.at));
-        if (GetNext(last))
-            SetPrevious(GetNext(last), last);
-        else
-            sequence.last = last;
-        SetNext(rank.at, first);
-        sequence.count += length;
-        return true;
+        return CedeValue<Natural, Elemental, Adjunct>(sequence, rank, static_cast<Deferential<Elemental>>(value));
     }
 
     template <
@@ -689,10 +1205,10 @@ namespace consecution {
         typename Elemental,
         Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
     static inline bool
-    Proceed(
+    ProceedDeferent(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const Elemental>
+        Deferential<Elemental>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -701,19 +1217,7 @@ namespace consecution {
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
-        using NodeLocational = Locational<SinglyNodal<Elemental>>;
-        NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
-        if (!result)
-            return false;
-        UnsetNext(result);
-        if (sequence.last)
-            SetNext(sequence.last, result);
-        else
-            sequence.first = result;
-        sequence.last = result;
-        sequence.count++;
-        return true;
+        return ProceedValue<Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Elemental>>(value));
     }
 
     template <
@@ -721,10 +1225,10 @@ namespace consecution {
         typename Elemental,
         Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
     static inline bool
-    Proceed(
+    ProceedDeferent(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const Elemental>
+        Deferential<Elemental>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -733,113 +1237,51 @@ namespace consecution {
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
-        using NodeLocational = Locational<DoublyNodal<Elemental>>;
-        NodeLocational result;
-        result = Adjunct.proclaim(sequence, value);
-        if (!result)
-            return false;
-        SetPrevious(result, sequence.last);
-        UnsetNext(result);
-        if (sequence.last)
-            SetNext(sequence.last, result);
-        else
-            sequence.first = result;
-        sequence.last = result;
-        sequence.count++;
-        return true;
+        return ProceedValue<Natural, Elemental, Adjunct>(sequence, static_cast<Deferential<Elemental>>(value));
     }
 
+    // Nodes are recycled or allocated ahead of assignment, so the element
+    // is constructed from the arguments and then moved into the node.
     template <
-        typename Relative,
-        typename Appositional,
-        typename RelativeNatural,
         typename Natural,
         typename Elemental,
         Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct,
-        const bool Safety>
+        typename... Arguments>
     static inline bool
-    Proceed(
+    Emplace(
         Referential<SinglyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
-            direction,
-        Referential<const Relative>
-            space,
-        Referential<const Appositional>
-            from,
-        Referential<const Appositional>
-            to)
+        Deferential<Arguments>... arguments)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
         using namespace ::std;
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
 #endif
-        using NodeLocational = Locational<SinglyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<SinglyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
-        NodeLocational first, last;
-        Natural length;
-        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-            return false;
-        UnsetNext(last);
-        if (sequence.last)
-            SetNext(sequence.last, first);
-        else
-            sequence.first = first;
-        sequence.last = last;
-        sequence.count += length;
-        return true;
+        return ProceedDeferent<Natural, Elemental, Adjunct>(sequence, Elemental(static_cast<Deferential<Arguments>>(arguments)...));
     }
 
+    // Nodes are recycled or allocated ahead of assignment, so the element
+    // is constructed from the arguments and then moved into the node.
     template <
-        typename Relative,
-        typename Appositional,
-        typename RelativeNatural,
         typename Natural,
         typename Elemental,
         Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct,
-        const bool Safety>
+        typename... Arguments>
     static inline bool
-    Proceed(
+    Emplace(
         Referential<DoublyJunctive<Natural, Elemental>>
             sequence,
-        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
-            direction,
-        Referential<const Relative>
-            space,
-        Referential<const Appositional>
-            from,
-        Referential<const Appositional>
-            to)
+        Deferential<Arguments>... arguments)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
         using namespace ::std;
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
-        static_assert(
-            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
-            "RelativeNatural:  Unsigned integer type required");
 #endif
-        using NodeLocational = Locational<DoublyNodal<Elemental>>;
-        static auto& SequenceList = Sequence<DoublyLinked<Elemental>, Relative, Appositional, RelativeNatural, Natural, Elemental, Adjunct, Safety>;
-        NodeLocational first, last;
-        Natural length;
-        if (!SequenceList(sequence, first, last, length, direction, space, from, to))
-            return false;
-        UnsetNext(last);
-        SetPrevious(first, sequence.last);
-        if (sequence.last)
-            SetNext(sequence.last, first);
-        else
-            sequence.first = first;
-        sequence.last = last;
-        sequence.count += length;
-        return true;
+        return ProceedDeferent<Natural, Elemental, Adjunct>(sequence, Elemental(static_cast<Deferential<Arguments>>(arguments)...));
     }
 
     template <
@@ -1161,6 +1603,271 @@ namespace consecution {
         return true;
     }
 
+    // The nodes transferred by the following functions remain allocated
+    // and are accounted to the target list, so both lists must release
+    // their nodes through the same adjunct (or compatible adjuncts).
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Concatenate(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            target,
+        Referential<SinglyJunctive<Natural, Elemental>>
+            source)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (&target == &source || !source.first)
+            return false;
+        if (target.last)
+            SetNext(target.last, source.first);
+        else
+            target.first = source.first;
+        target.last = source.last;
+        target.count += source.count;
+        target.total += source.count;
+        source.total -= source.count;
+        source.count = 0;
+        source.first = source.last = 0;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Concatenate(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            target,
+        Referential<DoublyJunctive<Natural, Elemental>>
+            source)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (&target == &source || !source.first)
+            return false;
+        if (target.last)
+            ConnectNext(target.last, source.first);
+        else
+            target.first = source.first;
+        target.last = source.last;
+        target.count += source.count;
+        target.total += source.count;
+        source.total -= source.count;
+        source.count = 0;
+        source.first = source.last = 0;
+        return true;
+    }
+
+    // Moves the count nodes following the previous position up to and
+    // including the to position from the source list to the target list
+    // after the rank position.  A previous position of zero denotes the
+    // range starting at the first node and a rank position of zero denotes
+    // insertion before the first node of the target list.
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Splice(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            target,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Referential<SinglyJunctive<Natural, Elemental>>
+            source,
+        Referential<const SinglyPositional<Elemental>>
+            previous,
+        Referential<const SinglyPositional<Elemental>>
+            to,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<SinglyNodal<Elemental>>;
+        NodeLocational first, next;
+        if (count <= 0 || &target == &source)
+            return false;
+        first = previous.at ? GetNext(previous.at) : source.first;
+        next = GetNext(to.at);
+        if (previous.at)
+            SetNext(previous.at, next);
+        else
+            source.first = next;
+        if (!next)
+            source.last = previous.at;
+        if (rank.at) {
+            SetNext(to.at, GetNext(rank.at));
+            SetNext(rank.at, first);
+        } else {
+            SetNext(to.at, target.first);
+            target.first = first;
+        }
+        if (!GetNext(to.at))
+            target.last = to.at;
+        source.count -= count;
+        source.total -= count;
+        target.count += count;
+        target.total += count;
+        return true;
+    }
+
+    // Moves the count nodes from the from position up to and including the
+    // to position from the source list to the target list after the rank
+    // position.  A rank position of zero denotes insertion before the first
+    // node of the target list.
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Splice(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            target,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Referential<DoublyJunctive<Natural, Elemental>>
+            source,
+        Referential<const DoublyPositional<Elemental>>
+            from,
+        Referential<const DoublyPositional<Elemental>>
+            to,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        NodeLocational previous, next;
+        if (count <= 0 || &target == &source)
+            return false;
+        previous = GetPrevious(from.at);
+        next = GetNext(to.at);
+        if (previous)
+            SetNext(previous, next);
+        else
+            source.first = next;
+        if (next)
+            SetPrevious(next, previous);
+        else
+            source.last = previous;
+        if (rank.at) {
+            next = GetNext(rank.at);
+            ConnectNext(rank.at, from.at);
+        } else {
+            next = target.first;
+            UnsetPrevious(from.at);
+            target.first = from.at;
+        }
+        ConnectNext(to.at, next);
+        if (!next)
+            target.last = to.at;
+        source.count -= count;
+        source.total -= count;
+        target.count += count;
+        target.total += count;
+        return true;
+    }
+
+    // Moves every node after the rank position from the source list to the
+    // end of the target list.  Only the moved nodes are visited, to count
+    // them.
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Split(
+        Referential<SinglyJunctive<Natural, Elemental>>
+            source,
+        Referential<const SinglyPositional<Elemental>>
+            rank,
+        Referential<SinglyJunctive<Natural, Elemental>>
+            target)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<SinglyNodal<Elemental>>;
+        NodeLocational first, current;
+        Natural count;
+        if (&target == &source || !GetNext(rank.at))
+            return false;
+        first = current = GetNext(rank.at);
+        for (count = 1; GetNext(current); count++)
+            current = GetNext(current);
+        UnsetNext(rank.at);
+        if (target.last)
+            SetNext(target.last, first);
+        else
+            target.first = first;
+        target.last = source.last;
+        source.last = rank.at;
+        source.count -= count;
+        source.total -= count;
+        target.count += count;
+        target.total += count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        typename Elemental>
+    static inline bool
+    Split(
+        Referential<DoublyJunctive<Natural, Elemental>>
+            source,
+        Referential<const DoublyPositional<Elemental>>
+            rank,
+        Referential<DoublyJunctive<Natural, Elemental>>
+            target)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
+        NodeLocational first, current;
+        Natural count;
+        if (&target == &source || !GetNext(rank.at))
+            return false;
+        first = current = GetNext(rank.at);
+        for (count = 1; GetNext(current); count++)
+            current = GetNext(current);
+        DisconnectNext(rank.at);
+        if (target.last)
+            ConnectNext(target.last, first);
+        else
+            target.first = first;
+        target.last = source.last;
+        source.last = rank.at;
+        source.count -= count;
+        source.total -= count;
+        target.count += count;
+        target.total += count;
+        return true;
+    }
+
     template <
         typename Relative,
         typename Appositional,
@@ -1234,6 +1941,30 @@ namespace consecution {
             DoubleConjoiner<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Natural, Natural, Elemental, Adjunct>
         };
 
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const SinglyAdjunctive<Natural, Elemental>> Adjunct>
+    constexpr Deferrable<SinglyJunctive<Natural, Elemental>, SinglyPositional<Elemental>, Elemental>
+        SingleDeferrer = {
+            AccedeDeferent<Natural, Elemental, Adjunct>,
+            PrecedeDeferent<Natural, Elemental, Adjunct>,
+            CedeDeferent<Natural, Elemental, Adjunct>,
+            ProceedDeferent<Natural, Elemental, Adjunct>
+        };
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<const DoublyAdjunctive<Natural, Elemental>> Adjunct>
+    constexpr Deferrable<DoublyJunctive<Natural, Elemental>, DoublyPositional<Elemental>, Elemental>
+        DoubleDeferrer = {
+            AccedeDeferent<Natural, Elemental, Adjunct>,
+            PrecedeDeferent<Natural, Elemental, Adjunct>,
+            CedeDeferent<Natural, Elemental, Adjunct>,
+            ProceedDeferent<Natural, Elemental, Adjunct>
+        };
+
 }
 
 }
@@ -634,7 +634,7 @@ namespace consecution {
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
-        using NodeLocational = Locational<SinglyNodal<Elemental>>;
+        using NodeLocational = Locational<DoublyNodal<Elemental>>;
         NodeLocational first, last;
         Natural index;
         if (count <= 0)
@@ -12,6 +12,119 @@ namespace contribution {
     using ::allocation::contribution::FastPoolAllocator;
     using ::allocation::contribution::SurePoolAllocator;
     using ::ration::contribution::Contributory;
+    using ::ration::contribution::Retribute;
+
+    /**
+     * @brief 
+     *     Pool compaction workspace conformity.
+     * @details  
+     *     This type is used as the workspace required to compact a linked 
+     *     list whose nodes are allocated from a pool.  It is only needed for
+     *     the duration of the compaction and may be reused.
+     * @tparam Natural
+     *     Type of unsigned integer.
+     * @tparam Maximum
+     *     The maximum number of nodes in the pool.
+     */
+    template <
+        typename Natural,
+        Natural Maximum>
+    struct Compactive {
+
+        Natural
+            destinations[Maximum]; /**< New index of each node of the list. */
+
+        bool
+            owned[Maximum], /**< Whether each index holds a node of the list. */
+            vacant[Maximum]; /**< Whether each index is unallocated. */
+    };
+
+    // Relocates the active nodes of the list so that they occupy the lowest
+    // indexes of the pool available to the list, in list order.  Indexes 
+    // available to the list are those of its own nodes and the unallocated
+    // indexes; nodes allocated to other lists are not moved.  The unused
+    // sublist of the list is returned to the pool beforehand and the 
+    // allotment of the pool is reduced by any unallocated indexes at its 
+    // end.  Positions into the list are invalidated.
+    template <
+        typename Connective,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Compact(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<Contributory<Natural, Maximum, Nodal<Connective, Elemental>>>
+            pool,
+        Referential<Compactive<Natural, Maximum>>
+            workspace)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+        const NodeLocational source = pool.resource.source;
+        auto swap = [&](const Natural first, const Natural second) {
+            const Nodal<Connective, Elemental> node = source[first];
+            const Natural destination = workspace.destinations[first];
+            const bool owned = workspace.owned[first], vacant = workspace.vacant[first];
+            source[first] = source[second];
+            source[second] = node;
+            workspace.destinations[first] = workspace.destinations[second];
+            workspace.destinations[second] = destination;
+            workspace.owned[first] = workspace.owned[second];
+            workspace.owned[second] = owned;
+            workspace.vacant[first] = workspace.vacant[second];
+            workspace.vacant[second] = vacant;
+        };
+        NodeLocational current, next, previous;
+        Natural index, cursor;
+        for (current = list.unused; current; current = next) {
+            next = GetNext(current);
+            Retribute(pool, static_cast<Natural>(current - source));
+            list.total--;
+        }
+        list.unused = 0;
+        for (index = 0; index < pool.resource.allotment; index++)
+            workspace.owned[index] = workspace.vacant[index] = false;
+        for (index = 0; index < pool.cycles; index++)
+            workspace.vacant[pool.recycle[index]] = true;
+        for (current = list.first; current; current = GetNext(current))
+            workspace.owned[current - source] = true;
+        cursor = 0;
+        for (current = list.first; current; current = GetNext(current)) {
+            while (!workspace.owned[cursor] && !workspace.vacant[cursor])
+                cursor++;
+            workspace.destinations[current - source] = cursor++;
+        }
+        for (index = 0; index < pool.resource.allotment; index++)
+            while (workspace.owned[index] && workspace.destinations[index] != index)
+                swap(index, workspace.destinations[index]);
+        previous = 0;
+        for (index = 0; index < pool.resource.allotment; index++) {
+            if (!workspace.owned[index])
+                continue;
+            current = source + index;
+            current->link = Connective();
+            if (previous)
+                ConnectNext(previous, current);
+            else
+                list.first = current;
+            previous = current;
+        }
+        list.last = previous;
+        while (pool.resource.allotment && workspace.vacant[pool.resource.allotment - 1])
+            pool.resource.allotment--;
+        pool.cycles = 0;
+        for (index = pool.resource.allotment; index-- > 0;)
+            if (workspace.vacant[index])
+                pool.recycle[pool.cycles++] = index;
+        return true;
+    }
 
     template <
         typename Natural,
@@ -0,0 +1,125 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef JUNCTION_INSTRUMENTATION_MODULE
+#define JUNCTION_INSTRUMENTATION_MODULE
+#include <instrumentation.hpp>
+#include <junction.hpp>
+
+namespace junction {
+
+/**
+ * @brief
+ *     Linked list node management instrumentation.
+ * @details
+ *     Adjunct objective which records the number of nodes allocated and
+ *     deallocated by the adjunct objective it wraps, recognized by changes
+ *     to the total number of nodes of the list, so that recycling of unused
+ *     nodes can be told apart from allocation.  Unless
+ *     RAPBTL_INSTRUMENTATION is defined, it holds the very same function
+ *     references as the adjunct it wraps.
+ */
+namespace instrumentation {
+
+    using ::instrumentation::Instrumental;
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct,
+        Referential<Instrumental<Natural>> Record>
+    static inline Locational<Nodal<Connective, Elemental>>
+    Allocate(Referential<Junctive<Connective, Natural, Elemental>> list)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural total = list.total;
+        const Locational<Nodal<Connective, Elemental>> result = Adjunct.allocate(list);
+        if (list.total > total)
+            Record.allocations += list.total - total;
+        return result;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    Deallocate(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<Locational<Nodal<Connective, Elemental>>>
+            node)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural total = list.total;
+        const bool result = Adjunct.deallocate(list, node);
+        if (list.total < total)
+            Record.deallocations += total - list.total;
+        return result;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct,
+        Referential<Instrumental<Natural>> Record>
+    static inline Locational<Nodal<Connective, Elemental>>
+    Proclaim(
+        Referential<Junctive<Connective, Natural, Elemental>>
+            list,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural total = list.total;
+        const Locational<Nodal<Connective, Elemental>> result = Adjunct.proclaim(list, value);
+        if (list.total > total)
+            Record.allocations += list.total - total;
+        return result;
+    }
+
+    template <
+        typename Connective,
+        typename Natural,
+        typename Elemental,
+        Referential<const Adjunctive<Connective, Natural, Elemental>> Adjunct,
+        Referential<Instrumental<Natural>> Record>
+#ifdef RAPBTL_INSTRUMENTATION
+    constexpr Adjunctive<Connective, Natural, Elemental>
+        InstrumentedAdjunct = {
+            Allocate<Connective, Natural, Elemental, Adjunct, Record>,
+            Deallocate<Connective, Natural, Elemental, Adjunct, Record>,
+            Proclaim<Connective, Natural, Elemental, Adjunct, Record>
+        };
+#else
+    constexpr Adjunctive<Connective, Natural, Elemental>
+        InstrumentedAdjunct = {
+            Adjunct.allocate,
+            Adjunct.deallocate,
+            Adjunct.proclaim
+        };
+#endif
+
+}
+
+}
+
+#endif
@@ -114,7 +114,7 @@ GoReadSafely(
         is_integral<Natural>::value && is_unsigned<Natural>::value,
         "Natural:  Unsigned integer type required");
 #endif
-    static auto& ContainsPosition = Contains<Connective, Natural, Elemental, true>;
+    static auto& ContainsPosition = Contains<Connective, Natural, Elemental>;
     if (!ContainsPosition(list, position))
         throw position;
     return GoRead(list, position);
@@ -138,7 +138,7 @@ GoWriteSafely(
         is_integral<Natural>::value && is_unsigned<Natural>::value,
         "Natural:  Unsigned integer type required");
 #endif
-    static auto& ContainsPosition = Contains<Connective, Natural, Elemental, true>;
+    static auto& ContainsPosition = Contains<Connective, Natural, Elemental>;
     if (!ContainsPosition(list, position))
         throw position;
     return GoWrite(list, position);
@@ -74,14 +74,13 @@ namespace selection {
             RecomposeSelection<
                 Natural,
                 Elemental,
-                Proceed<Natural, Elemental, Adjunct>,
-                SucceedSafely<Natural, Elemental>,
                 Equate,
-                SafeReadIncrementDoubleScale<Natural, Elemental>>,
+                SafeReadIncrementDoubleScale<Natural, Elemental>,
+                Adjunct>,
             DiscomposeSelection<
                 Natural,
                 Elemental,
-                SucceedSafely<Natural, Elemental>,
+                ConcedeSafely<Natural, Elemental>,
                 Equate,
                 SafeReadIncrementDoubleScale<Natural, Elemental>>,
             RemoveAll<DoublyLinked<Elemental>, Natural, Elemental>,
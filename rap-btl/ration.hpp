@@ -4,6 +4,7 @@
 #define RATION_MODULE
 #include <location.hpp>
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstring>
 #include <type_traits>
 #endif
 
@@ -15,6 +16,7 @@
  */
 namespace ration {
 
+using ::location::Deferential;
 using ::location::Locational;
 
 /**
@@ -162,6 +164,103 @@ MoveElements(
     return true;
 }
 
+/**
+ * @brief
+ *     Moves array elements by rvalue assignment.
+ * @details
+ *     Moves count array elements using the move assignment operator, from
+ *     one position to another within an array.  The direction of the move
+ *     determines the order of the assignments.
+ * @tparam Natural
+ *     Type of natural integer.
+ * @tparam Elemental 
+ *     Type of the elements.
+ * @param[in] from
+ *     Position to move the elements from.
+ * @param[in] to
+ *     Position to move the elements to.
+ * @param[in] count
+ *     Number of elements to move.
+ * @return 
+ *     This implementation always returns true.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+static inline bool
+DeferElements(
+    WritePositional<Elemental>
+        from,
+    WritePositional<Elemental>
+        to,
+    Natural
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (from < to)
+        for (Natural index = count; index > 0; index--) {
+            const Natural offset = index - 1;
+            to[offset] = static_cast<Deferential<Elemental>>(from[offset]);
+        }
+    else
+        for (Natural index = 0; index < count; index++)
+            to[index] = static_cast<Deferential<Elemental>>(from[index]);
+    return true;
+}
+
+/**
+ * @brief
+ *     Moves array elements using the fastest safe method for their type.
+ * @details
+ *     Moves count array elements from one position to another within an
+ *     array.  Trivially copyable elements are moved as bytes using the
+ *     standard memmove function, all other elements are moved using the
+ *     move assignment operator.  Without the C++ standard library the type
+ *     cannot be classified, so the move assignment operator is always used.
+ * @tparam Natural
+ *     Type of natural integer.
+ * @tparam Elemental 
+ *     Type of the elements.
+ * @param[in] from
+ *     Position to move the elements from.
+ * @param[in] to
+ *     Position to move the elements to.
+ * @param[in] count
+ *     Number of elements to move.
+ * @return 
+ *     This implementation always returns true.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+static inline bool
+RelocateElements(
+    WritePositional<Elemental>
+        from,
+    WritePositional<Elemental>
+        to,
+    Natural
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    if (is_trivially_copyable<Elemental>::value) {
+        if (count > 0)
+            memmove(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(Elemental));
+        return true;
+    }
+#endif
+    return DeferElements(from, to, count);
+}
+
 }
 
 #endif
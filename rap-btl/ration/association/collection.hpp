@@ -24,14 +24,21 @@ namespace association {
         using consecution::Account;
         using consecution::Antecede;
         using consecution::Cede;
+        using consecution::CedeDeferent;
         using consecution::Concede;
         using consecution::Concessive;
         using consecution::Condense;
         using consecution::Consequent;
+        using consecution::DeferredConsequent;
+        using consecution::DeferredPrecedent;
         using consecution::Precede;
+        using consecution::PrecedeDeferent;
         using consecution::Precedent;
         using consecution::Proceed;
+        using consecution::ProceedDeferent;
         using consecution::Secede;
+        using ::association::Deferrable;
+        using ::location::Deferential;
         using ::location::Locational;
         using ::location::Referential;
         using ::sortation::Assortive;
@@ -70,25 +77,34 @@ namespace association {
             return SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order);
         }
 
+        // Associations are shared between the copying and deferring
+        // functions, which differ only in whether the relator and value are
+        // copied or moved into the pair inserted into the map.  The pair is
+        // only built once the insertion point is found, so that rejected
+        // arguments are left intact.
         template <
             typename Natural,
             Natural Length,
             typename Correlative,
             typename Evaluative,
-            Referential<Precedent<Natural, Length, Complementary<Correlative, Evaluative>>> Precede,
-            Referential<Precedent<Natural, Length, Complementary<Correlative, Evaluative>>> Cede,
-            Referential<Consequent<Natural, Length, Complementary<Correlative, Evaluative>>> Proceed,
+            typename Precedential,
+            typename Consequential,
+            Referential<Precedential> Precede,
+            Referential<Precedential> Cede,
+            Referential<Consequential> Proceed,
             Referential<Assortive<Correlative>> Equate,
             Referential<Assortive<Correlative>> Order,
             Referential<const Lineal<const AssociativelyResourceful<Natural, Length, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
-            const bool Safety>
+            const bool Safety,
+            typename Relational,
+            typename Valuable>
         static inline bool
-        Associate(
+        AssociateValue(
             Referential<AssociativelyResourceful<Natural, Length, Correlative, Evaluative>>
                 map,
-            Referential<const Correlative>
+            Deferential<Relational>
                 relator,
-            Referential<const Evaluative>
+            Deferential<Valuable>
                 value)
         {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -100,18 +116,77 @@ namespace association {
             using MapComplementary = Complementary<Correlative, Evaluative>;
             using MapPositional = AssociativeReadPositional<Correlative, Evaluative>;
             static const Natural Before = 0;
-            const MapComplementary pair = { relator, value };
             MapPositional position;
             if (Safety && Account(map) >= Length)
                 return false;
             if (Safety && Account(map) < 1)
-                return Proceed(map, pair);
+                return Proceed(map, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
             Liner.increment.begin(map, position, 0);
             if (SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order) && Safety)
                 return false;
             if (Order(Liner.increment.go(map, position).to, relator))
-                return Cede(map, position, pair);
-            return Precede(map, position, pair);
+                return Cede(map, position, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
+            return Precede(map, position, MapComplementary { static_cast<Deferential<Relational>>(relator), static_cast<Deferential<Valuable>>(value) });
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Precedent<Natural, Length, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<Precedent<Natural, Length, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<Consequent<Natural, Length, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyResourceful<Natural, Length, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            const bool Safety>
+        static inline bool
+        Associate(
+            Referential<AssociativelyResourceful<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator,
+            Referential<const Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return AssociateValue<Natural, Length, Correlative, Evaluative, Precedent<Natural, Length, Complementary<Correlative, Evaluative>>, Consequent<Natural, Length, Complementary<Correlative, Evaluative>>, Precede, Cede, Proceed, Equate, Order, Liner, Safety>(map, relator, value);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<DeferredPrecedent<Natural, Length, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<DeferredPrecedent<Natural, Length, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<DeferredConsequent<Natural, Length, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyResourceful<Natural, Length, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            const bool Safety>
+        static inline bool
+        AssociateDeferent(
+            Referential<AssociativelyResourceful<Natural, Length, Correlative, Evaluative>>
+                map,
+            Deferential<Correlative>
+                relator,
+            Deferential<Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return AssociateValue<Natural, Length, Correlative, Evaluative, DeferredPrecedent<Natural, Length, Complementary<Correlative, Evaluative>>, DeferredConsequent<Natural, Length, Complementary<Correlative, Evaluative>>, Precede, Cede, Proceed, Equate, Order, Liner, Safety>(map, static_cast<Deferential<Correlative>>(relator), static_cast<Deferential<Evaluative>>(value));
         }
 
         template <
@@ -244,6 +319,32 @@ namespace association {
                 Condense<Natural, Length, Complementary<Correlative, Evaluative>>
             };
 
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Complementary<Correlative, Evaluative>>> Move>
+        constexpr Deferrable<AssociativelyResourceful<Natural, Length, Correlative, Evaluative>, Correlative, Evaluative>
+            FastDeferrer = {
+                AssociateDeferent<Natural, Length, Correlative, Evaluative, PrecedeDeferent<Natural, Length, Complementary<Correlative, Evaluative>, Move, false>, CedeDeferent<Natural, Length, Complementary<Correlative, Evaluative>, Move, false>, ProceedDeferent<Natural, Length, Complementary<Correlative, Evaluative>, false>, Equate, Order, ReadRelatorLiner<Natural, Length, Correlative, Evaluative>, false>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Complementary<Correlative, Evaluative>>> Move>
+        constexpr Deferrable<AssociativelyResourceful<Natural, Length, Correlative, Evaluative>, Correlative, Evaluative>
+            SureDeferrer = {
+                AssociateDeferent<Natural, Length, Correlative, Evaluative, PrecedeDeferent<Natural, Length, Complementary<Correlative, Evaluative>, Move, true>, CedeDeferent<Natural, Length, Complementary<Correlative, Evaluative>, Move, true>, ProceedDeferent<Natural, Length, Complementary<Correlative, Evaluative>, true>, Equate, Order, ReadRelatorLiner<Natural, Length, Correlative, Evaluative>, true>
+            };
+
     }
 
 }
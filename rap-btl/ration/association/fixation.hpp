@@ -0,0 +1,627 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_ASSOCIATION_FIXATION_MODULE
+#define RATION_ASSOCIATION_FIXATION_MODULE
+#include <association.hpp>
+#include <comparison.hpp>
+#include <ration.hpp>
+#include <sortation.hpp>
+#include <trajection.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+namespace association {
+
+    /**
+     * @brief
+     *     Frozen array map construction and vectorial trajection
+     *     implementation.
+     * @details
+     *     Array map which is built once from a list of mappings and never
+     *     modified afterwards.  The mappings are arranged by a minimal
+     *     perfect hash (hash and displace), so that every relator owns
+     *     exactly one slot of an array with as many slots as mappings.  A
+     *     lookup hashes the relator once to find its bucket, hashes it again
+     *     with the displacement seed of that bucket to find its slot and
+     *     compares the relator in that single slot.  The construction
+     *     functions are constexpr, so a map of literal mappings can be built
+     *     at compile time when both its hash and equate functions are
+     *     constexpr, such as HashIntegral and EquateIntegral, while maps of
+     *     run-time mappings are built at load time by the same functions.
+     */
+    namespace fixation {
+
+        using ::association::Complementary;
+        using ::comparison::Comparison;
+        using ::location::Conferential;
+        using ::location::Referential;
+        using ::sortation::Assortive;
+        using ::trajection::Vectorial;
+
+        /**
+         * @brief
+         *     Seeded hash function type.
+         * @details
+         *     Function type alias which hashes a relator with a seed.  Each
+         *     seed should behave as an independent hash function.  The
+         *     function, like the equate function, must be constexpr for a
+         *     frozen map to be built at compile time.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         */
+        template <
+            typename Correlative,
+            typename Natural>
+        using Hashing = Natural(
+            Referential<const Correlative>
+                relator,
+            Referential<const Natural>
+                seed);
+
+        /**
+         * @brief
+         *     Frozen map conformity.
+         * @details
+         *     Type definition which contains the displacement seed of every
+         *     bucket and the array of mappings arranged by slot.  The number
+         *     of buckets and the number of slots are both equal to the number
+         *     of mappings.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        struct Fixative {
+
+            Natural
+                seeds[Length]; /**< Displacement seed of each bucket. */
+
+            Complementary<Correlative, Evaluative>
+                pairs[Length]; /**< Mappings arranged by slot. */
+        };
+
+        /**
+         * @brief
+         *     Frozen map construction workspace.
+         * @details
+         *     Type definition of the scratch memory used while building a
+         *     frozen map.  A workspace is only needed during construction,
+         *     and may be placed in static or dynamic memory when building a
+         *     large map at load time.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         */
+        template <
+            typename Natural,
+            Natural Length>
+        struct Fixational {
+
+            Natural
+                offsets[Length + 1]; /**< First member of each bucket. */
+
+            Natural
+                members[Length]; /**< Mapping indices grouped by bucket. */
+
+            Natural
+                slots[Length]; /**< Slots tried for the bucket being placed. */
+
+            bool
+                occupied[Length]; /**< Whether each slot has been taken. */
+        };
+
+        /**
+         * @brief
+         *     Hashes an integral relator.
+         * @details
+         *     Seeded hash function for integral relators based on the
+         *     SplitMix64 finalizer.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Correlative
+         *     Type of the integral relators.
+         * @param[in] relator
+         *     Relator to hash.
+         * @param[in] seed
+         *     Seed of the hash.
+         * @return
+         *     The hash of the relator.
+         */
+        template <
+            typename Natural,
+            typename Correlative>
+        static constexpr Natural
+        HashIntegral(
+            Referential<const Correlative>
+                relator,
+            Referential<const Natural>
+                seed)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                is_integral<Correlative>::value,
+                "Correlative:  Integer type required");
+#endif
+            unsigned long long mix = static_cast<unsigned long long>(relator) + 0x9E3779B97F4A7C15ULL * (static_cast<unsigned long long>(seed) + 1);
+            mix = (mix ^ (mix >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            mix = (mix ^ (mix >> 27)) * 0x94D049BB133111EBULL;
+            return static_cast<Natural>(mix ^ (mix >> 31));
+        }
+
+        /**
+         * @brief
+         *     Compares two integral relators for equality.
+         * @details
+         *     Constexpr counterpart of comparison::IsEqual, which allows a
+         *     frozen map of integral relators to be built at compile time.
+         * @tparam Correlative
+         *     Type of the integral relators.
+         * @param[in] base
+         *     Reference to the base relator.
+         * @param[in] relative
+         *     Reference to the relative relator.
+         * @return
+         *     True if both relators are equal.
+         */
+        template <typename Correlative>
+        static constexpr bool
+        EquateIntegral(
+            Referential<const Correlative>
+                base,
+            Referential<const Correlative>
+                relative)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Correlative>::value,
+                "Correlative:  Integer type required");
+#endif
+            return base == relative;
+        }
+
+        /**
+         * @brief
+         *     Builds a frozen map.
+         * @details
+         *     Groups the mappings into buckets by their unseeded hash, then
+         *     places the buckets from the largest to the smallest, searching
+         *     for the first seed which sends every relator of the bucket to a
+         *     distinct free slot.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         * @tparam Equate
+         *     Function used to detect duplicate relators, which must be
+         *     constexpr for the map to be built at compile time.
+         * @tparam Hash
+         *     Seeded hash function.
+         * @param[out] map
+         *     Frozen map to build.
+         * @param[in] pairs
+         *     Mappings to freeze.
+         * @param[in,out] workspace
+         *     Construction scratch memory.
+         * @return
+         *     False if a relator is duplicated or no seed could be found for
+         *     some bucket.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Hashing<Correlative, Natural>> Hash>
+        static constexpr bool
+        Fix(
+            Referential<Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Complementary<Correlative, Evaluative>[Length]>
+                pairs,
+            Referential<Fixational<Natural, Length>>
+                workspace)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                Length > 0,
+                "Length:  At least one mapping required");
+#endif
+            constexpr Natural Unseeded = 0;
+            Natural largest = 0;
+            for (Natural bucket = 0; bucket <= Length; bucket++)
+                workspace.offsets[bucket] = 0;
+            for (Natural index = 0; index < Length; index++)
+                workspace.offsets[Hash(pairs[index].relator, Unseeded) % Length + 1]++;
+            for (Natural bucket = 0; bucket < Length; bucket++) {
+                const Natural size = workspace.offsets[bucket + 1];
+                if (size > largest)
+                    largest = size;
+                workspace.offsets[bucket + 1] += workspace.offsets[bucket];
+                map.seeds[bucket] = workspace.offsets[bucket];
+                workspace.occupied[bucket] = false;
+            }
+            for (Natural index = 0; index < Length; index++)
+                workspace.members[map.seeds[Hash(pairs[index].relator, Unseeded) % Length]++] = index;
+            for (Natural size = largest; size > 0; size--) {
+                for (Natural bucket = 0; bucket < Length; bucket++) {
+                    const Natural first = workspace.offsets[bucket];
+                    if (workspace.offsets[bucket + 1] - first != size)
+                        continue;
+                    for (Natural member = 1; member < size; member++)
+                        for (Natural prior = 0; prior < member; prior++)
+                            if (Equate(pairs[workspace.members[first + member]].relator, pairs[workspace.members[first + prior]].relator))
+                                return false;
+                    Natural seed = 1;
+                    while (true) {
+                        Natural member = 0;
+                        for (; member < size; member++) {
+                            const Natural slot = Hash(pairs[workspace.members[first + member]].relator, seed) % Length;
+                            if (workspace.occupied[slot])
+                                break;
+                            Natural prior = 0;
+                            while (prior < member && workspace.slots[prior] != slot)
+                                prior++;
+                            if (prior < member)
+                                break;
+                            workspace.slots[member] = slot;
+                        }
+                        if (member == size)
+                            break;
+                        if (++seed == 0)
+                            return false;
+                    }
+                    for (Natural member = 0; member < size; member++) {
+                        const Natural slot = workspace.slots[member];
+                        workspace.occupied[slot] = true;
+                        map.pairs[slot] = pairs[workspace.members[first + member]];
+                    }
+                    map.seeds[bucket] = seed;
+                }
+            }
+            for (Natural bucket = 0; bucket < Length; bucket++)
+                if (workspace.offsets[bucket + 1] == workspace.offsets[bucket])
+                    map.seeds[bucket] = Unseeded;
+            return true;
+        }
+
+        /**
+         * @brief
+         *     Returns a frozen map.
+         * @details
+         *     Builds and returns a frozen map by value, using a workspace in
+         *     automatic memory.  Intended for initializing constexpr frozen
+         *     maps from literal mappings, in which case a failure to build
+         *     the map is reported at compile time.  This function throws an
+         *     exception if the map could not be built.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         * @tparam Equate
+         *     Function used to detect duplicate relators, which must be
+         *     constexpr for the map to be built at compile time.
+         * @tparam Hash
+         *     Seeded hash function.
+         * @param[in] pairs
+         *     Mappings to freeze.
+         * @return
+         *     The frozen map.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Hashing<Correlative, Natural>> Hash>
+        static constexpr Fixative<Natural, Length, Correlative, Evaluative>
+        Fixed(
+            Referential<const Complementary<Correlative, Evaluative>[Length]>
+                pairs)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                Length > 0,
+                "Length:  At least one mapping required");
+#endif
+            Fixative<Natural, Length, Correlative, Evaluative> map = {};
+            Fixational<Natural, Length> workspace = {};
+            if (!Fix<Natural, Length, Correlative, Evaluative, Equate, Hash>(map, pairs, workspace))
+                throw Length;
+            return map;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Natural
+        Account(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Length;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Hashing<Correlative, Natural>> Hash>
+        static inline Natural
+        Slot(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static const Natural Unseeded = 0;
+            return Hash(relator, map.seeds[Hash(relator, Unseeded) % Length]) % Length;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Hashing<Correlative, Natural>> Hash>
+        static inline bool
+        Correspond(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& SlotRelator = Slot<Natural, Length, Correlative, Evaluative, Hash>;
+            return Equate(map.pairs[SlotRelator(map, relator)].relator, relator);
+        }
+
+        // This function template throws an exception if the relator (key)
+        // does not exist in the map.
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Hashing<Correlative, Natural>> Hash>
+        static inline Conferential<const Evaluative>
+        RelateReadElement(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& SlotRelator = Slot<Natural, Length, Correlative, Evaluative, Hash>;
+            Referential<const Complementary<Correlative, Evaluative>> pair = map.pairs[SlotRelator(map, relator)];
+            if (!Equate(pair.relator, relator))
+                throw relator;
+            return Confer(pair.value);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        ContainsSlot(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Natural>
+                slot)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return slot < Length;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<const Correlative>
+        GoReadRelator(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Natural>
+                slot)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(map.pairs[slot].relator);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<const Evaluative>
+        GoReadElement(
+            Referential<const Fixative<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Natural>
+                slot)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(map.pairs[slot].value);
+        }
+
+        /**
+         * @brief
+         *     Vectorial relator read trajection implementation.
+         * @details
+         *     Objective table which provides vectorial trajection to the
+         *     relators of a frozen map by slot.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Vectorial<const Fixative<Natural, Length, Correlative, Evaluative>, Natural, const Correlative>
+            ReadRelatorVector = {
+                Comparison<Natural>,
+                ContainsSlot<Natural, Length, Correlative, Evaluative>,
+                GoReadRelator<Natural, Length, Correlative, Evaluative>
+            };
+
+        /**
+         * @brief
+         *     Vectorial element read trajection implementation.
+         * @details
+         *     Objective table which provides vectorial trajection to the
+         *     values of a frozen map by slot.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Vectorial<const Fixative<Natural, Length, Correlative, Evaluative>, Natural, const Evaluative>
+            ReadElementVector = {
+                Comparison<Natural>,
+                ContainsSlot<Natural, Length, Correlative, Evaluative>,
+                GoReadElement<Natural, Length, Correlative, Evaluative>
+            };
+
+        /**
+         * @brief
+         *     Vectorial element read trajection by relator implementation.
+         * @details
+         *     Objective table which provides vectorial trajection to the
+         *     values of a frozen map using relators as positions.  Each
+         *     trajection costs a single probe, and going to a relator which
+         *     is not contained in the map throws the relator.
+         * @tparam Natural
+         *     Type of unsigned integer.
+         * @tparam Length
+         *     The number of mappings.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         * @tparam Equate
+         *     Function used to determine if two relators are equal.
+         * @tparam Hash
+         *     Seeded hash function the map was built with.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Hashing<Correlative, Natural>> Hash>
+        constexpr Vectorial<const Fixative<Natural, Length, Correlative, Evaluative>, Correlative, const Evaluative>
+            RelateReadElementVector = {
+                Comparison<Correlative>,
+                Correspond<Natural, Length, Correlative, Evaluative, Equate, Hash>,
+                RelateReadElement<Natural, Length, Correlative, Evaluative, Equate, Hash>
+            };
+
+    }
+
+}
+
+}
+
+#endif
@@ -0,0 +1,1128 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_ASSOCIATION_PARTITION_MODULE
+#define RATION_ASSOCIATION_PARTITION_MODULE
+#include <association.hpp>
+#include <comparison.hpp>
+#include <ration.hpp>
+#include <sortation.hpp>
+#include <trajection.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+namespace association {
+
+    /**
+     * @brief
+     *     Partitioned array sorted map management and trajection
+     *     implementation.
+     * @details
+     *     Array sorted map management and trajection implementation which
+     *     keeps the relators and the values in two parallel arrays rather
+     *     than interleaving them as pairs.  Searching by relator only
+     *     touches the dense relator array, which keeps bisection cache
+     *     friendly when the values are much larger than the relators.
+     *     Positions locate relators and the value at the same index in the
+     *     value array is reached from the same position.
+     */
+    namespace partition {
+
+        using ::association::Associative;
+        using ::comparison::Comparison;
+        using ::location::Conferential;
+        using ::location::Referential;
+        using ::sortation::Assortive;
+        using ::sortation::SearchBisection;
+        using ::trajection::Axial;
+        using ::trajection::Directional;
+        using ::trajection::Lineal;
+        using ::trajection::Scalar;
+
+        /**
+         * @brief
+         *     Partitioned map memory resource conformity.
+         * @details
+         *     Type definition which contains an allotment tracker, an array
+         *     of relators and a parallel array of values.  The value
+         *     associated with the relator at some index is found at the same
+         *     index in the value array.
+         * @tparam Natural
+         *     Type of natural integer used to track allotments.
+         * @tparam Length
+         *     The maximum number of mappings and size of the arrays.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        struct Partitive {
+
+            Natural
+                allotment; /**< Number of allotted mappings. */
+
+            Correlative
+                relators[Length]; /**< Array of sorted relators. */
+
+            Evaluative
+                values[Length]; /**< Array of values parallel to the relators. */
+        };
+
+        /**
+         * @brief
+         *     Partitioned map position type.
+         * @details
+         *     This type alias is used to represent a position in both the
+         *     read and write trajections of a partitioned map.  Positions
+         *     locate the relator array.
+         * @tparam Correlative
+         *     Type of the relators.
+         */
+        template <typename Correlative>
+        using PartitivePositional = ReadPositional<Correlative>;
+
+        /**
+         * @brief
+         *     Initialized partitioned map.
+         * @details
+         *     Initialized partitioned map value which can be used to
+         *     initialize an instance of the same partitioned map type.
+         * @tparam Natural
+         *     Type of natural integer used to track allotments.
+         * @tparam Length
+         *     The maximum number of mappings and size of the arrays.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Partitive<Natural, Length, Correlative, Evaluative>
+            InitializedPartition = { 0 };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+        Initialize(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            map.allotment = 0;
+            return map;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Natural
+        Account(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return map.allotment;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Natural
+        Index(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return static_cast<Natural>(position - map.relators);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Natural
+        CountIncrement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return static_cast<Natural>(map.relators + map.allotment - 1 - position);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Natural
+        CountDecrement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return static_cast<Natural>(position - map.relators);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        Begins(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return count < map.allotment;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        Meets(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return map.allotment > 0
+                && map.relators <= position
+                && position <= map.relators + map.allotment - 1;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        IncrementTraverses(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (map.allotment < 1)
+                return false;
+            return count <= CountIncrement(map, position);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        DecrementTraverses(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (map.allotment < 1)
+                return false;
+            return count <= CountDecrement(map, position);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        BeginReadIncrement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position = map.relators + count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        BeginWriteIncrement(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position = map.relators + count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        BeginReadDecrement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position = map.relators + map.allotment - count - 1;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        BeginWriteDecrement(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position = map.relators + map.allotment - count - 1;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        TraverseReadIncrement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position += count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        TraverseWriteIncrement(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position += count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        TraverseReadDecrement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position -= count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Referential<const PartitivePositional<Correlative>>
+        TraverseWriteDecrement(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<PartitivePositional<Correlative>>
+                position,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return position -= count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<const Correlative>
+        GoReadRelator(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Refer(position);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<const Evaluative>
+        GoReadElement(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(map.values[Index(map, position)]);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<Evaluative>
+        GoWriteElement(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const PartitivePositional<Correlative>>
+                position)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(map.values[Index(map, position)]);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Correlative>
+            ReadRelatorIncrementScale = {
+                Comparison<PartitivePositional<Correlative>>,
+                BeginReadIncrement<Natural, Length, Correlative, Evaluative>,
+                TraverseReadIncrement<Natural, Length, Correlative, Evaluative>,
+                GoReadRelator<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Correlative>
+            ReadRelatorDecrementScale = {
+                Comparison<PartitivePositional<Correlative>>,
+                BeginReadDecrement<Natural, Length, Correlative, Evaluative>,
+                TraverseReadDecrement<Natural, Length, Correlative, Evaluative>,
+                GoReadRelator<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Evaluative>
+            ReadElementIncrementScale = {
+                Comparison<PartitivePositional<Correlative>>,
+                BeginReadIncrement<Natural, Length, Correlative, Evaluative>,
+                TraverseReadIncrement<Natural, Length, Correlative, Evaluative>,
+                GoReadElement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Evaluative>
+            ReadElementDecrementScale = {
+                Comparison<PartitivePositional<Correlative>>,
+                BeginReadDecrement<Natural, Length, Correlative, Evaluative>,
+                TraverseReadDecrement<Natural, Length, Correlative, Evaluative>,
+                GoReadElement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, Evaluative>
+            WriteElementIncrementScale = {
+                Comparison<PartitivePositional<Correlative>>,
+                BeginWriteIncrement<Natural, Length, Correlative, Evaluative>,
+                TraverseWriteIncrement<Natural, Length, Correlative, Evaluative>,
+                GoWriteElement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, Evaluative>
+            WriteElementDecrementScale = {
+                Comparison<PartitivePositional<Correlative>>,
+                BeginWriteDecrement<Natural, Length, Correlative, Evaluative>,
+                TraverseWriteDecrement<Natural, Length, Correlative, Evaluative>,
+                GoWriteElement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Lineal<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Correlative>
+            ReadRelatorLiner = {
+                ReadRelatorIncrementScale<Natural, Length, Correlative, Evaluative>,
+                ReadRelatorDecrementScale<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Lineal<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Evaluative>
+            ReadElementLiner = {
+                ReadElementIncrementScale<Natural, Length, Correlative, Evaluative>,
+                ReadElementDecrementScale<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Lineal<Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, Evaluative>
+            WriteElementLiner = {
+                WriteElementIncrementScale<Natural, Length, Correlative, Evaluative>,
+                WriteElementDecrementScale<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Directional<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Correlative>
+            ReadRelatorIncrementDirection = {
+                ReadRelatorIncrementScale<Natural, Length, Correlative, Evaluative>,
+                Begins<Natural, Length, Correlative, Evaluative>,
+                IncrementTraverses<Natural, Length, Correlative, Evaluative>,
+                Meets<Natural, Length, Correlative, Evaluative>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                CountIncrement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Directional<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Correlative>
+            ReadRelatorDecrementDirection = {
+                ReadRelatorDecrementScale<Natural, Length, Correlative, Evaluative>,
+                Begins<Natural, Length, Correlative, Evaluative>,
+                DecrementTraverses<Natural, Length, Correlative, Evaluative>,
+                Meets<Natural, Length, Correlative, Evaluative>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                CountDecrement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Directional<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Evaluative>
+            ReadElementIncrementDirection = {
+                ReadElementIncrementScale<Natural, Length, Correlative, Evaluative>,
+                Begins<Natural, Length, Correlative, Evaluative>,
+                IncrementTraverses<Natural, Length, Correlative, Evaluative>,
+                Meets<Natural, Length, Correlative, Evaluative>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                CountIncrement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Directional<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Evaluative>
+            ReadElementDecrementDirection = {
+                ReadElementDecrementScale<Natural, Length, Correlative, Evaluative>,
+                Begins<Natural, Length, Correlative, Evaluative>,
+                DecrementTraverses<Natural, Length, Correlative, Evaluative>,
+                Meets<Natural, Length, Correlative, Evaluative>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                CountDecrement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Directional<Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, Evaluative>
+            WriteElementIncrementDirection = {
+                WriteElementIncrementScale<Natural, Length, Correlative, Evaluative>,
+                Begins<Natural, Length, Correlative, Evaluative>,
+                IncrementTraverses<Natural, Length, Correlative, Evaluative>,
+                Meets<Natural, Length, Correlative, Evaluative>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                CountIncrement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Directional<Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, Evaluative>
+            WriteElementDecrementDirection = {
+                WriteElementDecrementScale<Natural, Length, Correlative, Evaluative>,
+                Begins<Natural, Length, Correlative, Evaluative>,
+                DecrementTraverses<Natural, Length, Correlative, Evaluative>,
+                Meets<Natural, Length, Correlative, Evaluative>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                CountDecrement<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Axial<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Correlative>
+            ReadRelatorAxis = {
+                ReadRelatorIncrementDirection<Natural, Length, Correlative, Evaluative>,
+                ReadRelatorDecrementDirection<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Axial<const Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, const Evaluative>
+            ReadElementAxis = {
+                ReadElementIncrementDirection<Natural, Length, Correlative, Evaluative>,
+                ReadElementDecrementDirection<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Axial<Partitive<Natural, Length, Correlative, Evaluative>, PartitivePositional<Correlative>, Natural, Evaluative>
+            WriteElementAxis = {
+                WriteElementIncrementDirection<Natural, Length, Correlative, Evaluative>,
+                WriteElementDecrementDirection<Natural, Length, Correlative, Evaluative>
+            };
+
+        /**
+         * @brief
+         *     Searches the relator array.
+         * @details
+         *     Searches the relator array bisectionally for the relator.  If
+         *     the relator is not found, the index is set to where the
+         *     relator would be inserted to keep the relators sorted.
+         * @tparam Natural
+         *     Type of natural integer used to track allotments.
+         * @tparam Length
+         *     The maximum number of mappings and size of the arrays.
+         * @tparam Correlative
+         *     Type of the relators.
+         * @tparam Evaluative
+         *     Type of the values.
+         * @tparam Equate
+         *     Function used to determine if two relators are equal.
+         * @tparam Order
+         *     Function used to determine if two relators are in order.
+         * @param[in] map
+         *     Partitioned map to search.
+         * @param[in] relator
+         *     Relator to search for.
+         * @param[out] index
+         *     Index of the relator or of its insertion point.
+         * @return
+         *     Whether the relator was found.
+         */
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order>
+        static inline bool
+        Seek(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator,
+            Referential<Natural>
+                index)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& Liner = ReadRelatorLiner<Natural, Length, Correlative, Evaluative>;
+            static const Natural Before = 0;
+            PartitivePositional<Correlative> position;
+            index = 0;
+            if (map.allotment < 1)
+                return false;
+            Liner.increment.begin(map, position, 0);
+            const bool found = SearchBisection(map, Liner, relator, position, Before, (Natural) (map.allotment - 1), Equate, Order);
+            index = Index(map, position);
+            if (!found && Order(map.relators[index], relator))
+                index++;
+            return found;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            const bool Safety>
+        static inline bool
+        Correspond(
+            Referential<const Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& SeekRelator = Seek<Natural, Length, Correlative, Evaluative, Equate, Order>;
+            Natural index;
+            return SeekRelator(map, relator, index);
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Correlative>> MoveRelators,
+            Referential<MemoryMoving<Natural, Evaluative>> MoveValues,
+            const bool Safety>
+        static inline bool
+        Associate(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator,
+            Referential<const Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& SeekRelator = Seek<Natural, Length, Correlative, Evaluative, Equate, Order>;
+            Natural index;
+            if (Safety && map.allotment >= Length)
+                return false;
+            if (SeekRelator(map, relator, index) && Safety)
+                return false;
+            const Natural remaining = map.allotment - index;
+            if (remaining > 0) {
+                if (!MoveRelators(map.relators + index, map.relators + index + 1, remaining) && Safety)
+                    return false;
+                if (!MoveValues(map.values + index, map.values + index + 1, remaining) && Safety)
+                    return false;
+            }
+            map.relators[index] = relator;
+            map.values[index] = value;
+            map.allotment++;
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Correlative>> MoveRelators,
+            Referential<MemoryMoving<Natural, Evaluative>> MoveValues,
+            const bool Safety>
+        static inline bool
+        Reassociate(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                original,
+            Referential<const Correlative>
+                replacement)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& SeekRelator = Seek<Natural, Length, Correlative, Evaluative, Equate, Order>;
+            Natural original_index, replacement_index;
+            if (!SeekRelator(map, original, original_index) && Safety)
+                return false;
+            if (SeekRelator(map, replacement, replacement_index) && Safety)
+                return false;
+            const Evaluative value = map.values[original_index];
+            if (replacement_index < original_index) {
+                const Natural delta = original_index - replacement_index;
+                if (!MoveRelators(map.relators + replacement_index, map.relators + replacement_index + 1, delta) && Safety)
+                    return false;
+                if (!MoveValues(map.values + replacement_index, map.values + replacement_index + 1, delta) && Safety)
+                    return false;
+            } else if (replacement_index > original_index) {
+                const Natural delta = --replacement_index - original_index;
+                if (!MoveRelators(map.relators + original_index + 1, map.relators + original_index, delta) && Safety)
+                    return false;
+                if (!MoveValues(map.values + original_index + 1, map.values + original_index, delta) && Safety)
+                    return false;
+            }
+            map.relators[replacement_index] = replacement;
+            map.values[replacement_index] = value;
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Correlative>> MoveRelators,
+            Referential<MemoryMoving<Natural, Evaluative>> MoveValues,
+            const bool Safety>
+        static inline bool
+        Disassociate(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static auto& SeekRelator = Seek<Natural, Length, Correlative, Evaluative, Equate, Order>;
+            Natural index;
+            if (!SeekRelator(map, relator, index) && Safety)
+                return false;
+            const Natural remaining = map.allotment - index - 1;
+            if (remaining > 0) {
+                if (!MoveRelators(map.relators + index + 1, map.relators + index, remaining) && Safety)
+                    return false;
+                if (!MoveValues(map.values + index + 1, map.values + index, remaining) && Safety)
+                    return false;
+            }
+            map.allotment--;
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            const bool Safety>
+        static inline bool
+        Prepare(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && map.allotment >= Length)
+                return false;
+            return Length - map.allotment >= count;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        Disband(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            const bool actioned = map.allotment != 0;
+            map.allotment = 0;
+            return actioned;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative>
+        static inline bool
+        Dissolve(
+            Referential<Partitive<Natural, Length, Correlative, Evaluative>>
+                map)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return false;
+        }
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Correlative>> MoveRelators,
+            Referential<MemoryMoving<Natural, Evaluative>> MoveValues>
+        constexpr Associative<Partitive<Natural, Length, Correlative, Evaluative>, Natural, Correlative, Evaluative>
+            FastAssociator = {
+                Prepare<Natural, Length, Correlative, Evaluative, false>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                Correspond<Natural, Length, Correlative, Evaluative, Equate, Order, false>,
+                Associate<Natural, Length, Correlative, Evaluative, Equate, Order, MoveRelators, MoveValues, false>,
+                Reassociate<Natural, Length, Correlative, Evaluative, Equate, Order, MoveRelators, MoveValues, false>,
+                Disassociate<Natural, Length, Correlative, Evaluative, Equate, Order, MoveRelators, MoveValues, false>,
+                Disband<Natural, Length, Correlative, Evaluative>,
+                Dissolve<Natural, Length, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Length,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<MemoryMoving<Natural, Correlative>> MoveRelators,
+            Referential<MemoryMoving<Natural, Evaluative>> MoveValues>
+        constexpr Associative<Partitive<Natural, Length, Correlative, Evaluative>, Natural, Correlative, Evaluative>
+            SureAssociator = {
+                Prepare<Natural, Length, Correlative, Evaluative, true>,
+                Account<Natural, Length, Correlative, Evaluative>,
+                Correspond<Natural, Length, Correlative, Evaluative, Equate, Order, true>,
+                Associate<Natural, Length, Correlative, Evaluative, Equate, Order, MoveRelators, MoveValues, true>,
+                Reassociate<Natural, Length, Correlative, Evaluative, Equate, Order, MoveRelators, MoveValues, true>,
+                Disassociate<Natural, Length, Correlative, Evaluative, Equate, Order, MoveRelators, MoveValues, true>,
+                Disband<Natural, Length, Correlative, Evaluative>,
+                Dissolve<Natural, Length, Correlative, Evaluative>
+            };
+
+    }
+
+}
+
+}
+
+#endif
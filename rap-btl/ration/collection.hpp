@@ -22,19 +22,26 @@ namespace collection {
     using ::collection::Collective;
     using ::collection::EquateCollections;
     using ::composition::Compositional;
+    using ::composition::Deferrable;
     using consecution::Account;
     using consecution::Antecede;
     using consecution::Cede;
+    using consecution::CedeDeferent;
     using consecution::Concede;
     using consecution::Concessive;
     using consecution::Condense;
     using ::consecution::ConjointlyConsequent;
     using consecution::Consequent;
+    using consecution::DeferredConsequent;
+    using consecution::DeferredPrecedent;
     using consecution::Precede;
+    using consecution::PrecedeDeferent;
     using consecution::Precedent;
     using consecution::Proceed;
+    using consecution::ProceedDeferent;
     using consecution::ReadLiner;
     using consecution::Secede;
+    using ::location::Deferential;
     using ::location::Referential;
     using ::selection::EquateSelections;
     using ::selection::Sectional;
@@ -43,6 +50,7 @@ namespace collection {
     using ::sortation::SearchBisection;
     using ::sortation::SearchBisectionIteratively;
     using ::sortation::SearchSection;
+    using ::sortation::SortSegment;
     using ::trajection::Axial;
     using ::trajection::Directional;
     using ::trajection::Lineal;
@@ -76,22 +84,28 @@ namespace collection {
         return SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order);
     }
 
+    // Compositions are shared between the copying and deferring functions,
+    // which differ only in whether the value is copied or moved into the
+    // position found for it.
     template <
         typename Natural,
         Natural Length,
         typename Elemental,
-        Referential<Precedent<Natural, Length, Elemental>> Precede,
-        Referential<Precedent<Natural, Length, Elemental>> Cede,
-        Referential<Consequent<Natural, Length, Elemental>> Proceed,
+        typename Precedential,
+        typename Consequential,
+        Referential<Precedential> Precede,
+        Referential<Precedential> Cede,
+        Referential<Consequential> Proceed,
         Referential<Assortive<Elemental>> Equate,
         Referential<Assortive<Elemental>> Order,
         Referential<const Lineal<const Resourceful<Natural, Length, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
-        const bool Safety>
+        const bool Safety,
+        typename Valuable>
     static inline bool
-    ComposeCollection(
+    ComposeCollectionValue(
         Referential<Resourceful<Natural, Length, Elemental>>
             set,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -105,13 +119,67 @@ namespace collection {
         if (Safety && Account(set) >= Length)
             return false;
         if (Account(set) < 1)
-            return Proceed(set, value);
+            return Proceed(set, static_cast<Deferential<Valuable>>(value));
         Liner.increment.begin(set, position, 0);
         if (SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order) && Safety)
             return false;
         if (Order(Liner.increment.go(set, position).to, value))
-            return Cede(set, position, value);
-        return Precede(set, position, value);
+            return Cede(set, position, static_cast<Deferential<Valuable>>(value));
+        return Precede(set, position, static_cast<Deferential<Valuable>>(value));
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<Precedent<Natural, Length, Elemental>> Precede,
+        Referential<Precedent<Natural, Length, Elemental>> Cede,
+        Referential<Consequent<Natural, Length, Elemental>> Proceed,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const Lineal<const Resourceful<Natural, Length, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
+        const bool Safety>
+    static inline bool
+    ComposeCollection(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            set,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ComposeCollectionValue<Natural, Length, Elemental, Precedent<Natural, Length, Elemental>, Consequent<Natural, Length, Elemental>, Precede, Cede, Proceed, Equate, Order, Liner, Safety>(set, value);
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<DeferredPrecedent<Natural, Length, Elemental>> Precede,
+        Referential<DeferredPrecedent<Natural, Length, Elemental>> Cede,
+        Referential<DeferredConsequent<Natural, Length, Elemental>> Proceed,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<const Lineal<const Resourceful<Natural, Length, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
+        const bool Safety>
+    static inline bool
+    ComposeCollectionDeferent(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            set,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ComposeCollectionValue<Natural, Length, Elemental, DeferredPrecedent<Natural, Length, Elemental>, DeferredConsequent<Natural, Length, Elemental>, Precede, Cede, Proceed, Equate, Order, Liner, Safety>(set, static_cast<Deferential<Elemental>>(value));
     }
 
     template <
@@ -197,6 +265,42 @@ namespace collection {
         return true;
     }
 
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        const bool Safety>
+    static inline bool
+    ConstituteCollection(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            set,
+        const WritePositional<Elemental>
+            scratch)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Natural read, write;
+        if (Account(set) < 2)
+            return true;
+        SortSegment(set.source, scratch, Account(set), Order);
+        if (!Safety)
+            return true;
+        for (read = write = 1; read < Account(set); read++) {
+            if (!Equate(set.source[write - 1], set.source[read]))
+                set.source[write++] = set.source[read];
+        }
+        if (write == Account(set))
+            return true;
+        set.allotment = write;
+        return false;
+    }
+
     template <
         typename Basic,
         typename BasicPositional,
@@ -1050,7 +1154,7 @@ namespace collection {
         typename Elemental,
         Referential<Assortive<Elemental>> Equate,
         Referential<Assortive<Elemental>> Order,
-        Referential<MemoryMoving<Natural, Elemental>> Move>
+        Referential<MemoryMoving<Natural, Elemental>> Move = RelocateElements<Natural, Elemental>>
     constexpr Compositional<Resourceful<Natural, Length, Elemental>, Natural, Elemental>
         FastOrderedComposer = {
             Antecede<Natural, Length, Elemental, false>,
@@ -1101,7 +1205,7 @@ namespace collection {
         typename Elemental,
         Referential<Assortive<Elemental>> Equate,
         Referential<Assortive<Elemental>> Order,
-        Referential<MemoryMoving<Natural, Elemental>> Move>
+        Referential<MemoryMoving<Natural, Elemental>> Move = RelocateElements<Natural, Elemental>>
     constexpr Compositional<Resourceful<Natural, Length, Elemental>, Natural, Elemental>
         SureOrderedComposer = {
             Antecede<Natural, Length, Elemental, true>,
@@ -1146,6 +1250,50 @@ namespace collection {
             Condense<Natural, Length, Elemental>
         };
 
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<MemoryMoving<Natural, Elemental>> Move = RelocateElements<Natural, Elemental>>
+    constexpr Deferrable<Resourceful<Natural, Length, Elemental>, Elemental>
+        FastOrderedDeferrer = {
+            ComposeCollectionDeferent<
+                Natural,
+                Length,
+                Elemental,
+                PrecedeDeferent<Natural, Length, Elemental, Move, false>,
+                CedeDeferent<Natural, Length, Elemental, Move, false>,
+                ProceedDeferent<Natural, Length, Elemental, false>,
+                Equate,
+                Order,
+                ReadLiner<Natural, Length, Elemental>,
+                false>
+        };
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<Assortive<Elemental>> Equate,
+        Referential<Assortive<Elemental>> Order,
+        Referential<MemoryMoving<Natural, Elemental>> Move = RelocateElements<Natural, Elemental>>
+    constexpr Deferrable<Resourceful<Natural, Length, Elemental>, Elemental>
+        SureOrderedDeferrer = {
+            ComposeCollectionDeferent<
+                Natural,
+                Length,
+                Elemental,
+                PrecedeDeferent<Natural, Length, Elemental, Move, true>,
+                CedeDeferent<Natural, Length, Elemental, Move, true>,
+                ProceedDeferent<Natural, Length, Elemental, true>,
+                Equate,
+                Order,
+                ReadLiner<Natural, Length, Elemental>,
+                true>
+        };
+
     template <
         typename Basic,
         typename BasicPositional,
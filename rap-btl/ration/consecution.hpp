@@ -20,8 +20,10 @@ namespace consecution {
 
     using ::comparison::Comparison;
     using ::consecution::Conjoint;
+    using ::consecution::Deferrable;
     using ::consecution::Sequent;
     using ::location::Conferential;
+    using ::location::Deferential;
     using ::location::Locational;
     using ::location::Referential;
     using ::trajection::Axial;
@@ -51,6 +53,28 @@ namespace consecution {
         Referential<const Elemental>
             value);
 
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental>
+    using DeferredConsequent = bool(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Deferential<Elemental>
+            value);
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental>
+    using DeferredPrecedent = bool(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value);
+
     template <
         typename Natural,
         Natural Length,
@@ -585,17 +609,21 @@ namespace consecution {
         return Length - sequence.allotment >= count;
     }
 
+    // Insertions of a single element are shared between the copying and
+    // deferring functions, which differ only in whether the value is
+    // assigned from a constant or an expiring reference.
     template <
         typename Natural,
         Natural Length,
         typename Elemental,
         Referential<MemoryMoving<Natural, Elemental>> Move,
-        const bool Safety>
+        const bool Safety,
+        typename Valuable>
     static inline bool
-    Accede(
+    AccedeValue(
         Referential<Resourceful<Natural, Length, Elemental>>
             sequence,
-        Referential<const Elemental>
+        Deferential<Valuable>
             value)
     {
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
@@ -604,15 +632,134 @@ namespace consecution {
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
+        if (Safety && sequence.allotment >= Length)
+            return false;
         if (!Move(sequence.source, sequence.source + 1, sequence.allotment) && Safety)
             return false;
+        sequence.source[0] = static_cast<Deferential<Valuable>>(value);
+        sequence.allotment++;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety,
+        typename Valuable>
+    static inline bool
+    PrecedeValue(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Deferential<Valuable>
+            value)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && (rank < sequence.source || rank >= sequence.source + sequence.allotment))
+            return false;
+        if (Safety && sequence.allotment >= Length)
+            return false;
+        const Natural index = static_cast<Natural>(rank - sequence.source);
+        const WritePositional<Elemental> position = const_cast<WritePositional<Elemental>>(rank);
+        if (!Move(position, position + 1, sequence.allotment - index) && Safety)
+            return false;
+        Refer(position).to = static_cast<Deferential<Valuable>>(value);
+        sequence.allotment++;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety,
+        typename Valuable>
+    static inline bool
+    CedeValue(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Deferential<Valuable>
+            value)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && (rank < sequence.source || rank >= sequence.source + sequence.allotment))
+            return false;
         if (Safety && sequence.allotment >= Length)
             return false;
-        sequence.source[0] = value;
+        const WritePositional<Elemental> position = const_cast<WritePositional<Elemental>>(rank + 1);
+        const Natural index = static_cast<Natural>(position - sequence.source);
+        if (!Move(position, position + 1, sequence.allotment - index) && Safety)
+            return false;
+        Refer(position).to = static_cast<Deferential<Valuable>>(value);
         sequence.allotment++;
         return true;
     }
 
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        const bool Safety,
+        typename Valuable>
+    static inline bool
+    ProceedValue(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Deferential<Valuable>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && sequence.allotment >= Length)
+            return false;
+        sequence.source[sequence.allotment++] = static_cast<Deferential<Valuable>>(value);
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return AccedeValue<Natural, Length, Elemental, Move, Safety>(sequence, value);
+    }
+
     template <
         typename Relative,
         typename Appositional,
@@ -680,24 +827,13 @@ namespace consecution {
         Referential<const Elemental>
             value)
     {
-        using namespace ::location;
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
         using namespace ::std;
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
-        if (Safety && (rank < sequence.source || rank >= sequence.source + sequence.allotment))
-            return false;
-        if (Safety && sequence.allotment >= Length)
-            return false;
-        const Natural index = static_cast<Natural>(rank - sequence.source);
-        const WritePositional<Elemental> position = const_cast<WritePositional<Elemental>>(rank);
-        if (!Move(position, position + 1, sequence.allotment - index) && Safety)
-            return false;
-        Refer(position).to = value;
-        sequence.allotment++;
-        return true;
+        return PrecedeValue<Natural, Length, Elemental, Move, Safety>(sequence, rank, value);
     }
 
     template <
@@ -773,22 +909,13 @@ namespace consecution {
         Referential<const Elemental>
             value)
     {
-        using namespace ::location;
 #ifndef RAPBTL_NO_STD_CPLUSPLUS
         using namespace ::std;
         static_assert(
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
-        if (Safety && (rank < sequence.source || rank >= sequence.source + sequence.allotment))
-            return false;
-        const WritePositional<Elemental> position = const_cast<WritePositional<Elemental>>(rank + 1);
-        const Natural index = static_cast<Natural>(position - sequence.source);
-        if (!Move(position, position + 1, sequence.allotment - index) && Safety)
-            return false;
-        Refer(position).to = value;
-        sequence.allotment++;
-        return true;
+        return CedeValue<Natural, Length, Elemental, Move, Safety>(sequence, rank, value);
     }
 
     template <
@@ -865,10 +992,7 @@ namespace consecution {
             is_integral<Natural>::value && is_unsigned<Natural>::value,
             "Natural:  Unsigned integer type required");
 #endif
-        if (Safety && sequence.allotment >= Length)
-            return false;
-        sequence.source[sequence.allotment++] = value;
-        return true;
+        return ProceedValue<Natural, Length, Elemental, Safety>(sequence, value);
     }
 
     template <
@@ -916,6 +1040,124 @@ namespace consecution {
         return true;
     }
 
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    AccedeDeferent(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return AccedeValue<Natural, Length, Elemental, Move, Safety>(sequence, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    PrecedeDeferent(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return PrecedeValue<Natural, Length, Elemental, Move, Safety>(sequence, rank, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    CedeDeferent(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return CedeValue<Natural, Length, Elemental, Move, Safety>(sequence, rank, static_cast<Deferential<Elemental>>(value));
+    }
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    ProceedDeferent(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Deferential<Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return ProceedValue<Natural, Length, Elemental, Safety>(sequence, static_cast<Deferential<Elemental>>(value));
+    }
+
+    // Array elements are constructed along with the resource, so the
+    // element is constructed from the arguments and then moved into the
+    // next allotted position without any intermediate copy.
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        const bool Safety,
+        typename... Arguments>
+    static inline bool
+    Emplace(
+        Referential<Resourceful<Natural, Length, Elemental>>
+            sequence,
+        Deferential<Arguments>... arguments)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && sequence.allotment >= Length)
+            return false;
+        sequence.source[sequence.allotment++] = Elemental(static_cast<Deferential<Arguments>>(arguments)...);
+        return true;
+    }
+
     template <
         typename Natural,
         Natural Length,
@@ -1143,6 +1385,32 @@ namespace consecution {
             SureConjoiner<Resourceful<Natural, Length, Elemental>, ReadPositional<Elemental>, Natural, Natural, Length, Elemental, Move>
         };
 
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Deferrable<Resourceful<Natural, Length, Elemental>, ReadPositional<Elemental>, Elemental>
+        FastDeferrer = {
+            AccedeDeferent<Natural, Length, Elemental, Move, false>,
+            PrecedeDeferent<Natural, Length, Elemental, Move, false>,
+            CedeDeferent<Natural, Length, Elemental, Move, false>,
+            ProceedDeferent<Natural, Length, Elemental, false>
+        };
+
+    template <
+        typename Natural,
+        Natural Length,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Deferrable<Resourceful<Natural, Length, Elemental>, ReadPositional<Elemental>, Elemental>
+        SureDeferrer = {
+            AccedeDeferent<Natural, Length, Elemental, Move, true>,
+            PrecedeDeferent<Natural, Length, Elemental, Move, true>,
+            CedeDeferent<Natural, Length, Elemental, Move, true>,
+            ProceedDeferent<Natural, Length, Elemental, true>
+        };
+
     template <
         typename Natural,
         Natural Length,
@@ -0,0 +1,896 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_CONTRACTION_CONSECUTION_MODULE
+#define RATION_CONTRACTION_CONSECUTION_MODULE
+#include <consecution.hpp>
+#include <ration/contraction.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+namespace contraction {
+
+    /**
+     * @brief
+     *     Double ended queue sequence management implementation.
+     * @details
+     *     Sequence management implementation for queues, treating the array
+     *     as a ring so that elements are inserted at or removed from either
+     *     end in constant time.  Inserting or removing elsewhere moves the
+     *     elements on whichever side of the position is shorter.  Positions
+     *     are indices into the array, as with the queue trajection
+     *     objectives, and are invalidated whenever the sequence is modified.
+     */
+    namespace consecution {
+
+        using ::consecution::Conjoint;
+        using ::consecution::Sequent;
+        using ::location::Locational;
+
+        /**
+         * @brief
+         *     Two segment view of a queue.
+         * @details
+         *     Type definition which describes the allotted elements of a
+         *     queue as at most two contiguous runs of memory elements, the
+         *     head run from the first element to the end of the array and
+         *     the tail run from the beginning of the array, so that they can
+         *     be processed in bulk.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Elemental
+         *     Type of the elements.
+         */
+        template <
+            typename Natural,
+            typename Elemental>
+        struct Bipartite {
+
+            Locational<Elemental>
+                head, /**< First element of the head run. */
+                tail; /**< First element of the tail run. */
+
+            Natural
+                head_count, /**< Number of elements in the head run. */
+                tail_count; /**< Number of elements in the tail run. */
+        };
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline Natural
+        Locate(
+            Referential<const Contractional<Natural, Maximum, Elemental>>
+                queue,
+            const Natural
+                offset)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return offset < Maximum - queue.first ? queue.first + offset : offset - (Maximum - queue.first);
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline Natural
+        Offset(
+            Referential<const Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                index)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return index >= queue.first ? index - queue.first : index + (Maximum - queue.first);
+        }
+
+        /**
+         * @brief
+         *     Opens room for elements at an offset.
+         * @details
+         *     Moves the elements before the specified offset towards the
+         *     beginning of the queue, or those from the offset onward
+         *     towards the end of the queue, whichever are fewer, leaving
+         *     count unassigned elements at the offset.  The queue must have
+         *     room for count more elements.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Maximum
+         *     The maximum number of elements.
+         * @tparam Elemental
+         *     Type of the elements.
+         * @param[in,out] queue
+         *     Reference to the queue.
+         * @param[in] offset
+         *     Offset from the first element at which room is opened.
+         * @param[in] count
+         *     Number of elements to make room for.
+         */
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline void
+        Open(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            const Natural
+                offset,
+            const Natural
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            const WritePositional<Elemental> source = queue.resource.source;
+            const Natural allotment = queue.resource.allotment;
+            if (offset < allotment - offset) {
+                const Natural previous = queue.first;
+                queue.first = count > previous ? previous + (Maximum - count) : previous - count;
+                for (Natural moved = 0; moved < offset; moved++) {
+                    const Natural from = moved < Maximum - previous ? previous + moved : moved - (Maximum - previous);
+                    source[Locate(queue, moved)] = source[from];
+                }
+            } else {
+                for (Natural remaining = allotment - offset; remaining > 0; remaining--) {
+                    const Natural moved = offset + remaining - 1;
+                    source[Locate(queue, moved + count)] = source[Locate(queue, moved)];
+                }
+            }
+            queue.resource.allotment += count;
+        }
+
+        /**
+         * @brief
+         *     Closes a run of elements at an offset.
+         * @details
+         *     Removes count elements beginning at the specified offset by
+         *     moving the elements before them towards the end of the queue,
+         *     or those after them towards the beginning of the queue,
+         *     whichever are fewer.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Maximum
+         *     The maximum number of elements.
+         * @tparam Elemental
+         *     Type of the elements.
+         * @param[in,out] queue
+         *     Reference to the queue.
+         * @param[in] offset
+         *     Offset from the first element of the first element removed.
+         * @param[in] count
+         *     Number of elements to remove.
+         */
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline void
+        Close(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            const Natural
+                offset,
+            const Natural
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            const WritePositional<Elemental> source = queue.resource.source;
+            const Natural following = queue.resource.allotment - offset - count;
+            if (offset < following) {
+                for (Natural moved = offset; moved > 0; moved--)
+                    source[Locate(queue, moved - 1 + count)] = source[Locate(queue, moved - 1)];
+                queue.first = Locate(queue, count);
+            } else {
+                for (Natural moved = offset + count; moved < queue.resource.allotment; moved++)
+                    source[Locate(queue, moved - count)] = source[Locate(queue, moved)];
+            }
+            queue.resource.allotment -= count;
+            if (!queue.resource.allotment)
+                queue.first = 0;
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Antecede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Maximum - queue.resource.allotment >= count;
+        }
+
+        /**
+         * @brief
+         *     Inserts an element at an offset.
+         * @details
+         *     Opens room for the element at the specified offset from the
+         *     first element and assigns it.  Inserting at either end of the
+         *     queue moves no other elements.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Maximum
+         *     The maximum number of elements.
+         * @tparam Elemental
+         *     Type of the elements.
+         * @tparam Safety
+         *     Whether the queue is checked for room.
+         * @param[in,out] queue
+         *     Reference to the queue.
+         * @param[in] offset
+         *     Offset from the first element at which to insert.
+         * @param[in] value
+         *     Value of the element to insert.
+         * @return
+         *     True if the element was inserted.
+         */
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Interpose(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            const Natural
+                offset,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && queue.resource.allotment >= Maximum)
+                return false;
+            Open<Natural, Maximum, Elemental>(queue, offset, 1);
+            queue.resource.source[Locate(queue, offset)] = value;
+            return true;
+        }
+
+        /**
+         * @brief
+         *     Inserts a range of elements at an offset.
+         * @details
+         *     Counts the range of elements in the relative space, opens room
+         *     for them at the specified offset from the first element and
+         *     assigns them.
+         * @tparam Relative
+         *     Type of the relative space.
+         * @tparam Appositional
+         *     Type of positions in the relative space.
+         * @tparam RelativeNatural
+         *     Type of natural integer of the relative space.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Maximum
+         *     The maximum number of elements.
+         * @tparam Elemental
+         *     Type of the elements.
+         * @tparam Safety
+         *     Whether the queue is checked for room.
+         * @param[in,out] queue
+         *     Reference to the queue.
+         * @param[in] offset
+         *     Offset from the first element at which to insert.
+         * @param[in] direction
+         *     Reference to the direction objective of the relative space.
+         * @param[in] space
+         *     Reference to the relative space.
+         * @param[in] from
+         *     Position of the first element of the range.
+         * @param[in] to
+         *     Position of the last element of the range.
+         * @return
+         *     True if the elements were inserted.
+         */
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Interpose(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            const Natural
+                offset,
+            Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+                direction,
+            Referential<const Relative>
+                space,
+            Referential<const Appositional>
+                from,
+            Referential<const Appositional>
+                to)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+                "RelativeNatural:  Unsigned integer type required");
+#endif
+            Appositional apposition = from;
+            Natural count = 1;
+            while (direction.scale.order.equality.is_not_equal(apposition, to)) {
+                if (Safety && !direction.traverses(space, apposition, 1))
+                    return false;
+                direction.scale.traverse(space, apposition, 1);
+                count++;
+            }
+            if (Safety && count > Maximum - queue.resource.allotment)
+                return false;
+            Open<Natural, Maximum, Elemental>(queue, offset, count);
+            apposition = from;
+            for (Natural moved = 0; moved < count; moved++) {
+                queue.resource.source[Locate(queue, offset + moved)] = direction.scale.go(space, apposition).to;
+                direction.scale.traverse(space, apposition, 1);
+            }
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Accede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Interpose<Natural, Maximum, Elemental, Safety>(queue, 0, value);
+        }
+
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Accede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+                direction,
+            Referential<const Relative>
+                space,
+            Referential<const Appositional>
+                from,
+            Referential<const Appositional>
+                to)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+                "RelativeNatural:  Unsigned integer type required");
+#endif
+            return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>(queue, 0, direction, space, from, to);
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Precede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                rank,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && !Contains(queue, rank))
+                return false;
+            return Interpose<Natural, Maximum, Elemental, Safety>(queue, Offset(queue, rank), value);
+        }
+
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Precede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                rank,
+            Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+                direction,
+            Referential<const Relative>
+                space,
+            Referential<const Appositional>
+                from,
+            Referential<const Appositional>
+                to)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+                "RelativeNatural:  Unsigned integer type required");
+#endif
+            if (Safety && !Contains(queue, rank))
+                return false;
+            return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>(queue, Offset(queue, rank), direction, space, from, to);
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Cede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                rank,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && !Contains(queue, rank))
+                return false;
+            return Interpose<Natural, Maximum, Elemental, Safety>(queue, Offset(queue, rank) + 1, value);
+        }
+
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Cede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                rank,
+            Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+                direction,
+            Referential<const Relative>
+                space,
+            Referential<const Appositional>
+                from,
+            Referential<const Appositional>
+                to)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+                "RelativeNatural:  Unsigned integer type required");
+#endif
+            if (Safety && !Contains(queue, rank))
+                return false;
+            return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>(queue, Offset(queue, rank) + 1, direction, space, from, to);
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Proceed(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Interpose<Natural, Maximum, Elemental, Safety>(queue, queue.resource.allotment, value);
+        }
+
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Proceed(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+                direction,
+            Referential<const Relative>
+                space,
+            Referential<const Appositional>
+                from,
+            Referential<const Appositional>
+                to)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+            static_assert(
+                is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+                "RelativeNatural:  Unsigned integer type required");
+#endif
+            return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Safety>(queue, queue.resource.allotment, direction, space, from, to);
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Succeed(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && count > queue.resource.allotment)
+                return false;
+            Close<Natural, Maximum, Elemental>(queue, 0, count);
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Supersede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                rank,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && !Contains(queue, rank))
+                return false;
+            const Natural end = Offset(queue, rank) + 1;
+            if (Safety && count > end)
+                return false;
+            Close<Natural, Maximum, Elemental>(queue, end - count, count);
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Concede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                rank,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && !Contains(queue, rank))
+                return false;
+            const Natural offset = Offset(queue, rank);
+            if (Safety && count > queue.resource.allotment - offset)
+                return false;
+            Close<Natural, Maximum, Elemental>(queue, offset, count);
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental,
+            const bool Safety>
+        static inline bool
+        Recede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue,
+            Referential<const Natural>
+                count)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            if (Safety && count > queue.resource.allotment)
+                return false;
+            Close<Natural, Maximum, Elemental>(queue, queue.resource.allotment - count, count);
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline bool
+        Secede(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Contract(queue);
+        }
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline bool
+        Condense(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue)
+        {
+            return false;
+        }
+
+        /**
+         * @brief
+         *     Bisects a queue for reading.
+         * @details
+         *     Provides the allotted elements of the queue as a head run and
+         *     a tail run of contiguous memory elements.  The tail run is
+         *     empty unless the queue wraps around the end of the array.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Maximum
+         *     The maximum number of elements.
+         * @tparam Elemental
+         *     Type of the elements.
+         * @param[in] queue
+         *     Reference to the queue.
+         * @return
+         *     The two segment view of the queue.
+         */
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline Bipartite<Natural, const Elemental>
+        ReadBisect(
+            Referential<const Contractional<Natural, Maximum, Elemental>>
+                queue)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            const Natural room = Maximum - queue.first, allotment = queue.resource.allotment;
+            const Natural head_count = allotment < room ? allotment : room;
+            return { queue.resource.source + queue.first, queue.resource.source, head_count, static_cast<Natural>(allotment - head_count) };
+        }
+
+        /**
+         * @brief
+         *     Bisects a queue for writing.
+         * @details
+         *     Provides the allotted elements of the queue as a head run and
+         *     a tail run of contiguous modifiable memory elements.  The tail
+         *     run is empty unless the queue wraps around the end of the
+         *     array.
+         * @tparam Natural
+         *     Type of natural integer for sizes.
+         * @tparam Maximum
+         *     The maximum number of elements.
+         * @tparam Elemental
+         *     Type of the elements.
+         * @param[in] queue
+         *     Reference to the queue.
+         * @return
+         *     The two segment view of the queue.
+         */
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        static inline Bipartite<Natural, Elemental>
+        WriteBisect(
+            Referential<Contractional<Natural, Maximum, Elemental>>
+                queue)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            const Natural room = Maximum - queue.first, allotment = queue.resource.allotment;
+            const Natural head_count = allotment < room ? allotment : room;
+            return { queue.resource.source + queue.first, queue.resource.source, head_count, static_cast<Natural>(allotment - head_count) };
+        }
+
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        constexpr Conjoint<Contractional<Natural, Maximum, Elemental>, Natural, Relative, Appositional, RelativeNatural, Elemental>
+            FastConjoiner = {
+                Accede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>,
+                Precede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>,
+                Cede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>,
+                Proceed<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, false>
+            };
+
+        template <
+            typename Relative,
+            typename Appositional,
+            typename RelativeNatural,
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        constexpr Conjoint<Contractional<Natural, Maximum, Elemental>, Natural, Relative, Appositional, RelativeNatural, Elemental>
+            SureConjoiner = {
+                Accede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, true>,
+                Precede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, true>,
+                Cede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, true>,
+                Proceed<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, true>
+            };
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        constexpr Sequent<Contractional<Natural, Maximum, Elemental>, Natural, Natural, Elemental>
+            FastSequencer = {
+                Antecede<Natural, Maximum, Elemental, false>,
+                Account<Natural, Maximum, Elemental>,
+                Accede<Natural, Maximum, Elemental, false>,
+                Precede<Natural, Maximum, Elemental, false>,
+                Cede<Natural, Maximum, Elemental, false>,
+                Proceed<Natural, Maximum, Elemental, false>,
+                Succeed<Natural, Maximum, Elemental, false>,
+                Supersede<Natural, Maximum, Elemental, false>,
+                Concede<Natural, Maximum, Elemental, false>,
+                Recede<Natural, Maximum, Elemental, false>,
+                Secede<Natural, Maximum, Elemental>,
+                Condense<Natural, Maximum, Elemental>,
+                FastConjoiner<Contractional<Natural, Maximum, Elemental>, Natural, Natural, Natural, Maximum, Elemental>
+            };
+
+        template <
+            typename Natural,
+            Natural Maximum,
+            typename Elemental>
+        constexpr Sequent<Contractional<Natural, Maximum, Elemental>, Natural, Natural, Elemental>
+            SureSequencer = {
+                Antecede<Natural, Maximum, Elemental, true>,
+                Account<Natural, Maximum, Elemental>,
+                Accede<Natural, Maximum, Elemental, true>,
+                Precede<Natural, Maximum, Elemental, true>,
+                Cede<Natural, Maximum, Elemental, true>,
+                Proceed<Natural, Maximum, Elemental, true>,
+                Succeed<Natural, Maximum, Elemental, true>,
+                Supersede<Natural, Maximum, Elemental, true>,
+                Concede<Natural, Maximum, Elemental, true>,
+                Recede<Natural, Maximum, Elemental, true>,
+                Secede<Natural, Maximum, Elemental>,
+                Condense<Natural, Maximum, Elemental>,
+                SureConjoiner<Contractional<Natural, Maximum, Elemental>, Natural, Natural, Natural, Maximum, Elemental>
+            };
+
+    }
+
+}
+
+}
+
+#endif
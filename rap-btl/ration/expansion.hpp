@@ -0,0 +1,1764 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_EXPANSION_MODULE
+#define RATION_EXPANSION_MODULE
+#include <allocation.hpp>
+#include <consecution.hpp>
+#include <ration.hpp>
+#include <ration/vectorization.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+/**
+ * @brief
+ *     Growable array sequence management implementation.
+ * @details
+ *     Heap based memory rationing conformity, initialization facility and
+ *     array sequence management implementation.  Unlike a resource, the
+ *     array of an expansion is claimed from an array allocation objective
+ *     and grows geometrically as elements are added, so that appending is
+ *     amortized constant time and no maximum number of elements need be
+ *     specified.  Up to a fixed number of elements are stored inline
+ *     within the expansion itself, an array being claimed only once they
+ *     no longer fit.  Removing every element does not free the array,
+ *     condense reclaims the array to fit the number of elements, returning
+ *     them to the inline array when they fit.  Positions are invalidated
+ *     whenever the array grows or is condensed.
+ */
+namespace expansion {
+
+    using ::allocation::ArrayAllocative;
+    using ::comparison::Comparison;
+    using ::consecution::Conjoint;
+    using ::consecution::Sequent;
+    using ::location::Conferential;
+    using ::location::Locational;
+    using ::location::Referential;
+    using ::trajection::Axial;
+    using ::trajection::Directional;
+    using ::trajection::Lineal;
+    using ::trajection::Scalar;
+    using vectorization::DefaultThreshold;
+    using vectorization::StreamBytes;
+
+    /**
+     * @brief
+     *     Growable memory resource conformity.
+     * @details
+     *     Type definition which contains an allotment tracker, the capacity
+     *     of the claimed array, a pointer to the claimed array of memory
+     *     elements and an inline array of memory elements.  While the
+     *     elements fit within the inline array, no array is claimed and the
+     *     source pointer is null, so that the expansion may be copied and
+     *     initialized like a resource.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Inlined
+     *     Whether any elements are stored inline.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        const bool Inlined = (Inline > 0)>
+    struct Expansive {
+
+        Natural
+            allotment, /**< Number of allotted elements. */
+            capacity; /**< Number of elements in the claimed array. */
+
+        Locational<Elemental>
+            source; /**< Claimed array of memory elements. */
+
+        Elemental
+            buffer[Inline]; /**< Inline array of memory elements. */
+    };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    struct Expansive<Natural, Inline, Elemental, false> {
+
+        Natural
+            allotment, /**< Number of allotted elements. */
+            capacity; /**< Number of elements in the claimed array. */
+
+        Locational<Elemental>
+            source; /**< Claimed array of memory elements. */
+    };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline ReadPositional<Elemental>
+    Buffer(
+        Referential<const Expansive<Natural, Inline, Elemental, true>>
+            sequence)
+    {
+        return sequence.buffer;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline WritePositional<Elemental>
+    Buffer(
+        Referential<Expansive<Natural, Inline, Elemental, true>>
+            sequence)
+    {
+        return sequence.buffer;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline ReadPositional<Elemental>
+    Buffer(
+        Referential<const Expansive<Natural, Inline, Elemental, false>>
+            sequence)
+    {
+        return 0;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline WritePositional<Elemental>
+    Buffer(
+        Referential<Expansive<Natural, Inline, Elemental, false>>
+            sequence)
+    {
+        return 0;
+    }
+
+    /**
+     * @brief
+     *     Array in use by an expansion.
+     * @details
+     *     Provides the claimed array if one has been claimed, otherwise the
+     *     inline array.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @param[in] sequence
+     *     Reference to the expansion.
+     * @return
+     *     Position of the first element of the array in use.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline ReadPositional<Elemental>
+    Source(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+        return sequence.source ? sequence.source : Buffer(sequence);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline WritePositional<Elemental>
+    Source(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+        return sequence.source ? sequence.source : Buffer(sequence);
+    }
+
+    /**
+     * @brief
+     *     Number of elements the array in use can hold.
+     * @details
+     *     Provides the capacity of the claimed array if one has been
+     *     claimed, otherwise the number of inline elements.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @param[in] sequence
+     *     Reference to the expansion.
+     * @return
+     *     Capacity of the array in use.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Natural
+    Capacity(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return sequence.source ? sequence.capacity : Inline;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    using Consequent = bool(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value);
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    using Precedent = bool(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value);
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    using Concessive = bool(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Natural>
+            count);
+
+    /**
+     * @brief
+     *     Initialized expansion.
+     * @details
+     *     Initialized expansion value which can be used to initialize an
+     *     instance of the same expansion type.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Expansive<Natural, Inline, Elemental>
+        InitializedExpansion = { 0, 0, 0 };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<Expansive<Natural, Inline, Elemental>>
+    Initialize(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        sequence.allotment = sequence.capacity = 0;
+        sequence.source = 0;
+        return sequence;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Natural
+    Account(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return sequence.allotment;
+    }
+
+    /**
+     * @brief
+     *     Replaces the array of an expansion.
+     * @details
+     *     Claims an array of the specified capacity, or uses the inline
+     *     array if the capacity does not exceed it, moves the allotted
+     *     elements into it and disclaims the previous array if one was
+     *     claimed.  The capacity must not be less than the number of
+     *     allotted elements.  Elements are moved into the claimed array by
+     *     assignment, so elements which are not trivially copyable require
+     *     an allocator which constructs them, such as ArrayNew, rather than
+     *     one which claims raw memory, such as ArrayMalloc.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Allocator
+     *     Reference to the array allocation objective.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @param[in,out] sequence
+     *     Reference to the expansion.
+     * @param[in] capacity
+     *     Number of elements of the array to be claimed.
+     * @return
+     *     True if the array was replaced.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    static inline bool
+    Reclaim(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Natural>
+            capacity)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_trivially_copyable<Elemental>::value || &Allocator.claim == &::allocation::AllocateNewArray<Natural, Elemental>,
+            "Allocator:  Constructing allocator required for elements which are not trivially copyable");
+#endif
+        Locational<Elemental> source = 0;
+        if (capacity > Inline) {
+            if (!Allocator.claim(source, capacity))
+                return false;
+            if (sequence.allotment > 0 && !Move(Source(sequence), source, sequence.allotment)) {
+                Allocator.disclaim(source);
+                return false;
+            }
+        } else if (sequence.source) {
+            if (sequence.allotment > 0 && !Move(sequence.source, Buffer(sequence), sequence.allotment))
+                return false;
+        } else {
+            return true;
+        }
+        if (sequence.source)
+            Allocator.disclaim(sequence.source);
+        sequence.source = source;
+        sequence.capacity = source ? capacity : 0;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Ensures room for additional elements.
+     * @details
+     *     If the array does not have room for count more elements, the
+     *     capacity is doubled until it does and the array is reclaimed.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Allocator
+     *     Reference to the array allocation objective.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @tparam Safety
+     *     Whether the number of elements is checked for overflow.
+     * @param[in,out] sequence
+     *     Reference to the expansion.
+     * @param[in] count
+     *     Number of additional elements.
+     * @return
+     *     True if the array has room for count more elements.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Expand(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static const Natural Maximum = static_cast<Natural>(~static_cast<Natural>(0));
+        if (Safety && count > Maximum - sequence.allotment)
+            return false;
+        const Natural required = sequence.allotment + count;
+        if (required <= Capacity(sequence))
+            return true;
+        Natural capacity = Capacity(sequence) > 0 ? Capacity(sequence) : 1;
+        while (capacity < required)
+            capacity = capacity > Maximum / 2 ? required : capacity * 2;
+        return Reclaim<Natural, Inline, Elemental, Allocator, Move>(sequence, capacity);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Natural
+    CountReadIncrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return static_cast<Natural>(Source(sequence) + sequence.allotment - 1 - position);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Natural
+    CountWriteIncrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return static_cast<Natural>(Source(sequence) + sequence.allotment - 1 - position);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Natural
+    CountReadDecrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return static_cast<Natural>(position - Source(sequence));
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Natural
+    CountWriteDecrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return static_cast<Natural>(position - Source(sequence));
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    Begins(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return count < sequence.allotment;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    ReadMeets(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return sequence.allotment > 0
+            && Source(sequence) <= position
+            && position <= Source(sequence) + sequence.allotment - 1;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    WriteMeets(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return sequence.allotment > 0
+            && Source(sequence) <= position
+            && position <= Source(sequence) + sequence.allotment - 1;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Conferential<Elemental>
+    GoWrite(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Refer(position);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Conferential<const Elemental>
+    GoRead(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Refer(position);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    BeginReadIncrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Source(sequence) + count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    BeginWriteIncrement(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Source(sequence) + count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    ReadIncrementTraverses(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (sequence.allotment < 1)
+            return false;
+        return position + count <= Source(sequence) + sequence.allotment - 1;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    WriteIncrementTraverses(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (sequence.allotment < 1)
+            return false;
+        return position + count <= Source(sequence) + sequence.allotment - 1;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    TraverseReadIncrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position += count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    TraverseWriteIncrement(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position += count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    BeginReadDecrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Source(sequence) + sequence.allotment - count - 1;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    BeginWriteDecrement(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Source(sequence) + sequence.allotment - count - 1;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    ReadDecrementTraverses(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (sequence.allotment < 1)
+            return false;
+        return Source(sequence) <= position - count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    WriteDecrementTraverses(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (sequence.allotment < 1)
+            return false;
+        return Source(sequence) <= position - count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    TraverseReadDecrement(
+        Referential<const Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position -= count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    TraverseWriteDecrement(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position -= count;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Antecede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, count);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static const Natural One = 1;
+        if (sequence.allotment >= Capacity(sequence)) {
+            const Elemental element = value;
+            if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, One))
+                return false;
+            return Accede<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, element);
+        }
+        if (!Move(Source(sequence), Source(sequence) + 1, sequence.allotment) && Safety)
+            return false;
+        Source(sequence)[0] = value;
+        sequence.allotment++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        Appositional apposition = from;
+        Natural count = 1;
+        while (direction.scale.order.equality.is_not_equal(apposition, to)) {
+            if (Safety && !direction.traverses(space, apposition, 1))
+                return false;
+            direction.scale.traverse(space, apposition, 1);
+            count++;
+        }
+        if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, count))
+            return false;
+        if (!Move(Source(sequence), Source(sequence) + count, sequence.allotment) && Safety)
+            return false;
+        apposition = from;
+        for (Natural offset = 0; offset < count; offset++) {
+            Source(sequence)[offset] = direction.scale.go(space, apposition).to;
+            direction.scale.traverse(space, apposition, 1);
+        }
+        sequence.allotment += count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Precede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static const Natural One = 1;
+        if (Safety && (rank < Source(sequence) || rank >= Source(sequence) + sequence.allotment))
+            return false;
+        const Natural index = static_cast<Natural>(rank - Source(sequence));
+        if (sequence.allotment >= Capacity(sequence)) {
+            const Elemental element = value;
+            if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, One))
+                return false;
+            const ReadPositional<Elemental> position = Source(sequence) + index;
+            return Precede<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, position, element);
+        }
+        const WritePositional<Elemental> position = Source(sequence) + index;
+        if (!Move(position, position + 1, sequence.allotment - index) && Safety)
+            return false;
+        Refer(position).to = value;
+        sequence.allotment++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Precede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        if (Safety && (rank < Source(sequence) || rank >= Source(sequence) + sequence.allotment))
+            return false;
+        Appositional apposition = from;
+        Natural count = 1;
+        const Natural index = static_cast<Natural>(rank - Source(sequence));
+        while (direction.scale.order.equality.is_not_equal(apposition, to)) {
+            if (Safety && !direction.traverses(space, apposition, 1))
+                return false;
+            direction.scale.traverse(space, apposition, 1);
+            count++;
+        }
+        if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, count))
+            return false;
+        const WritePositional<Elemental> position = Source(sequence) + index;
+        if (!Move(position, position + count, sequence.allotment - index) && Safety)
+            return false;
+        apposition = from;
+        for (Natural offset = 0; offset < count; offset++) {
+            position[offset] = direction.scale.go(space, apposition).to;
+            direction.scale.traverse(space, apposition, 1);
+        }
+        sequence.allotment += count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Cede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static const Natural One = 1;
+        if (Safety && (rank < Source(sequence) || rank >= Source(sequence) + sequence.allotment))
+            return false;
+        const Natural index = static_cast<Natural>(rank - Source(sequence)) + 1;
+        if (sequence.allotment >= Capacity(sequence)) {
+            const Elemental element = value;
+            if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, One))
+                return false;
+            const ReadPositional<Elemental> position = Source(sequence) + index - 1;
+            return Cede<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, position, element);
+        }
+        const WritePositional<Elemental> position = Source(sequence) + index;
+        if (!Move(position, position + 1, sequence.allotment - index) && Safety)
+            return false;
+        Refer(position).to = value;
+        sequence.allotment++;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Cede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        if (Safety && (rank < Source(sequence) || rank >= Source(sequence) + sequence.allotment))
+            return false;
+        Appositional apposition = from;
+        Natural count = 1;
+        const Natural index = static_cast<Natural>(rank - Source(sequence)) + 1;
+        while (direction.scale.order.equality.is_not_equal(apposition, to)) {
+            if (Safety && !direction.traverses(space, apposition, 1))
+                return false;
+            direction.scale.traverse(space, apposition, 1);
+            count++;
+        }
+        if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, count))
+            return false;
+        const WritePositional<Elemental> first = Source(sequence) + index;
+        if (!Move(first, first + count, sequence.allotment - index) && Safety)
+            return false;
+        apposition = from;
+        for (Natural offset = 0; offset < count; offset++) {
+            first[offset] = direction.scale.go(space, apposition).to;
+            direction.scale.traverse(space, apposition, 1);
+        }
+        sequence.allotment += count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static const Natural One = 1;
+        if (sequence.allotment >= Capacity(sequence)) {
+            const Elemental element = value;
+            if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, One))
+                return false;
+            Source(sequence)[sequence.allotment++] = element;
+            return true;
+        }
+        Source(sequence)[sequence.allotment++] = value;
+        return true;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        static const Natural One = 1;
+        Appositional apposition = from;
+        if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, One))
+            return false;
+        Source(sequence)[sequence.allotment++] = direction.scale.go(space, apposition).to;
+        while (direction.scale.order.equality.is_not_equal(apposition, to)) {
+            if (Safety && !direction.traverses(space, apposition, 1))
+                return false;
+            direction.scale.traverse(space, apposition, 1);
+            if (!Expand<Natural, Inline, Elemental, Allocator, Move, Safety>(sequence, One))
+                return false;
+            Source(sequence)[sequence.allotment++] = direction.scale.go(space, apposition).to;
+        }
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Succeed(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && count > sequence.allotment)
+            return false;
+        const Natural remaining = sequence.allotment - count;
+        if (remaining > 0)
+            if (!Move(Source(sequence) + count, Source(sequence), remaining) && Safety)
+                return false;
+        sequence.allotment -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Supersede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && (rank < Source(sequence) || rank >= Source(sequence) + sequence.allotment))
+            return false;
+        const WritePositional<Elemental> first = const_cast<WritePositional<Elemental>>(rank) + 1;
+        if (Safety && first < Source(sequence) + count)
+            return false;
+        const Natural remaining = sequence.allotment - static_cast<Natural>(first - Source(sequence));
+        if (remaining > 0)
+            if (!Move(first, first - count, remaining) && Safety)
+                return false;
+        sequence.allotment -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Concede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && (rank < Source(sequence) || rank >= Source(sequence) + sequence.allotment))
+            return false;
+        const WritePositional<Elemental> position = const_cast<WritePositional<Elemental>>(rank),
+                                         first = position + count;
+        if (Safety && first > Source(sequence) + sequence.allotment)
+            return false;
+        const Natural remaining = sequence.allotment - static_cast<Natural>(first - Source(sequence));
+        if (remaining > 0)
+            if (!Move(first, position, remaining) && Safety)
+                return false;
+        sequence.allotment -= count;
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Recede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && count > sequence.allotment)
+            return false;
+        sequence.allotment -= count;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Condenses the array to fit the allotted elements.
+     * @details
+     *     Reclaims an array with exactly as many elements as are allotted,
+     *     or moves them into the inline array and disclaims the array if
+     *     they fit.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Allocator
+     *     Reference to the array allocation objective.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @param[in,out] sequence
+     *     Reference to the expansion.
+     * @return
+     *     True if the array was condensed.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    static inline bool
+    Condense(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (!sequence.source || sequence.capacity == sequence.allotment)
+            return false;
+        return Reclaim<Natural, Inline, Elemental, Allocator, Move>(sequence, sequence.allotment);
+    }
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    static inline bool
+    Secede(
+        Referential<Expansive<Natural, Inline, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const bool actioned = sequence.allotment != 0;
+        sequence.allotment = 0;
+        return actioned;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Conjoint<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Relative, Appositional, RelativeNatural, Elemental>
+        FastConjoiner = {
+            Accede<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, false>,
+            Precede<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, false>,
+            Cede<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, false>,
+            Proceed<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, false>
+        };
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Conjoint<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Relative, Appositional, RelativeNatural, Elemental>
+        SureConjoiner = {
+            Accede<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, true>,
+            Precede<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, true>,
+            Cede<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, true>,
+            Proceed<Relative, Appositional, RelativeNatural, Natural, Inline, Elemental, Allocator, Move, true>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Sequent<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, Elemental>
+        FastSequencer = {
+            Antecede<Natural, Inline, Elemental, Allocator, Move, false>,
+            Account<Natural, Inline, Elemental>,
+            Accede<Natural, Inline, Elemental, Allocator, Move, false>,
+            Precede<Natural, Inline, Elemental, Allocator, Move, false>,
+            Cede<Natural, Inline, Elemental, Allocator, Move, false>,
+            Proceed<Natural, Inline, Elemental, Allocator, Move, false>,
+            Succeed<Natural, Inline, Elemental, Move, false>,
+            Supersede<Natural, Inline, Elemental, Move, false>,
+            Concede<Natural, Inline, Elemental, Move, false>,
+            Recede<Natural, Inline, Elemental, false>,
+            Secede<Natural, Inline, Elemental>,
+            Condense<Natural, Inline, Elemental, Allocator, Move>,
+            FastConjoiner<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, Natural, Inline, Elemental, Allocator, Move>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Sequent<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, Elemental>
+        SureSequencer = {
+            Antecede<Natural, Inline, Elemental, Allocator, Move, true>,
+            Account<Natural, Inline, Elemental>,
+            Accede<Natural, Inline, Elemental, Allocator, Move, true>,
+            Precede<Natural, Inline, Elemental, Allocator, Move, true>,
+            Cede<Natural, Inline, Elemental, Allocator, Move, true>,
+            Proceed<Natural, Inline, Elemental, Allocator, Move, true>,
+            Succeed<Natural, Inline, Elemental, Move, true>,
+            Supersede<Natural, Inline, Elemental, Move, true>,
+            Concede<Natural, Inline, Elemental, Move, true>,
+            Recede<Natural, Inline, Elemental, true>,
+            Secede<Natural, Inline, Elemental>,
+            Condense<Natural, Inline, Elemental, Allocator, Move>,
+            SureConjoiner<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, Natural, Inline, Elemental, Allocator, Move>
+        };
+
+    /**
+     * @brief
+     *     Expansion sequencer which streams reclaimed arrays.
+     * @details
+     *     Fast sequencer for trivially copyable elements which moves them
+     *     using streaming stores when the array is reclaimed and the
+     *     elements occupy at least the threshold number of bytes, so that
+     *     growing a large expansion does not evict the rest of the working
+     *     set from the processor caches.  Elements shifted within the array
+     *     are still moved with the standard memmove function.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Allocator
+     *     Reference to the array allocation objective.
+     * @tparam Threshold
+     *     Number of bytes at or above which streaming stores are used.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        size_t Threshold = DefaultThreshold>
+    constexpr Sequent<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, Elemental>
+        FastStreamingSequencer = FastSequencer<Natural, Inline, Elemental, Allocator, StreamBytes<Natural, Elemental, Threshold>>;
+
+    /**
+     * @brief
+     *     Safe expansion sequencer which streams reclaimed arrays.
+     * @details
+     *     Sure sequencer for trivially copyable elements which moves them
+     *     using streaming stores when the array is reclaimed and the
+     *     elements occupy at least the threshold number of bytes.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Inline
+     *     Number of elements stored inline before an array is claimed.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Allocator
+     *     Reference to the array allocation objective.
+     * @tparam Threshold
+     *     Number of bytes at or above which streaming stores are used.
+     */
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental,
+        Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+        size_t Threshold = DefaultThreshold>
+    constexpr Sequent<Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, Elemental>
+        SureStreamingSequencer = SureSequencer<Natural, Inline, Elemental, Allocator, StreamBytes<Natural, Elemental, Threshold>>;
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Scalar<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementScale = {
+            Comparison<ReadPositional<Elemental>>,
+            BeginReadIncrement<Natural, Inline, Elemental>,
+            TraverseReadIncrement<Natural, Inline, Elemental>,
+            GoRead<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Scalar<Expansive<Natural, Inline, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteIncrementScale = {
+            Comparison<WritePositional<Elemental>>,
+            BeginWriteIncrement<Natural, Inline, Elemental>,
+            TraverseWriteIncrement<Natural, Inline, Elemental>,
+            GoWrite<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Scalar<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadDecrementScale = {
+            Comparison<ReadPositional<Elemental>>,
+            BeginReadDecrement<Natural, Inline, Elemental>,
+            TraverseReadDecrement<Natural, Inline, Elemental>,
+            GoRead<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Scalar<Expansive<Natural, Inline, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteDecrementScale = {
+            Comparison<WritePositional<Elemental>>,
+            BeginWriteDecrement<Natural, Inline, Elemental>,
+            TraverseWriteDecrement<Natural, Inline, Elemental>,
+            GoWrite<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Lineal<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadLiner = {
+            ReadIncrementScale<Natural, Inline, Elemental>,
+            ReadDecrementScale<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Lineal<Expansive<Natural, Inline, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteLiner = {
+            WriteIncrementScale<Natural, Inline, Elemental>,
+            WriteDecrementScale<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Directional<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementDirection = {
+            ReadIncrementScale<Natural, Inline, Elemental>,
+            Begins<Natural, Inline, Elemental>,
+            ReadIncrementTraverses<Natural, Inline, Elemental>,
+            ReadMeets<Natural, Inline, Elemental>,
+            Account<Natural, Inline, Elemental>,
+            CountReadIncrement<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Directional<Expansive<Natural, Inline, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteIncrementDirection = {
+            WriteIncrementScale<Natural, Inline, Elemental>,
+            Begins<Natural, Inline, Elemental>,
+            WriteIncrementTraverses<Natural, Inline, Elemental>,
+            WriteMeets<Natural, Inline, Elemental>,
+            Account<Natural, Inline, Elemental>,
+            CountWriteIncrement<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Directional<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadDecrementDirection = {
+            ReadDecrementScale<Natural, Inline, Elemental>,
+            Begins<Natural, Inline, Elemental>,
+            ReadDecrementTraverses<Natural, Inline, Elemental>,
+            ReadMeets<Natural, Inline, Elemental>,
+            Account<Natural, Inline, Elemental>,
+            CountReadDecrement<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Directional<Expansive<Natural, Inline, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteDecrementDirection = {
+            WriteDecrementScale<Natural, Inline, Elemental>,
+            Begins<Natural, Inline, Elemental>,
+            WriteDecrementTraverses<Natural, Inline, Elemental>,
+            WriteMeets<Natural, Inline, Elemental>,
+            Account<Natural, Inline, Elemental>,
+            CountWriteDecrement<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Axial<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadAxis = {
+            ReadIncrementDirection<Natural, Inline, Elemental>,
+            ReadDecrementDirection<Natural, Inline, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Inline,
+        typename Elemental>
+    constexpr Axial<Expansive<Natural, Inline, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteAxis = {
+            WriteIncrementDirection<Natural, Inline, Elemental>,
+            WriteDecrementDirection<Natural, Inline, Elemental>
+        };
+
+}
+
+}
+
+#endif
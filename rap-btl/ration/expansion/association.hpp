@@ -0,0 +1,435 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_EXPANSION_ASSOCIATION_MODULE
+#define RATION_EXPANSION_ASSOCIATION_MODULE
+#include <association.hpp>
+#include <ration/expansion.hpp>
+#include <sortation.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+namespace expansion {
+
+    /**
+     * @brief
+     *     Growable array sorted map management implementation.
+     * @details
+     *     Growable array sorted map management implementation.
+     */
+    namespace association {
+
+        using ::association::Associative;
+        using ::association::Complementary;
+        using ::location::Referential;
+        using ::sortation::Assortive;
+        using ::sortation::SearchBisection;
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        using AssociativelyExpansive = Expansive<Natural, Inline, Complementary<Correlative, Evaluative>>;
+
+        template <
+            typename Correlative,
+            typename Evaluative>
+        using AssociativeReadPositional = ReadPositional<Complementary<Correlative, Evaluative>>;
+
+        template <
+            typename Correlative,
+            typename Evaluative>
+        using AssociativeWritePositional = WritePositional<Complementary<Correlative, Evaluative>>;
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<const Correlative>
+        GoReadRelator(
+            Referential<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const AssociativeReadPositional<Correlative, Evaluative>>
+                position)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(GoRead(map, position).to.relator);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<const Evaluative>
+        GoReadElement(
+            Referential<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const AssociativeReadPositional<Correlative, Evaluative>>
+                position)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(GoRead(map, position).to.value);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        static inline Conferential<Evaluative>
+        GoWriteElement(
+            Referential<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const AssociativeWritePositional<Correlative, Evaluative>>
+                position)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            return Confer(GoWrite(map, position).to.value);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>
+            ReadRelatorIncrementScale = {
+                Comparison<AssociativeReadPositional<Correlative, Evaluative>>,
+                BeginReadIncrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                TraverseReadIncrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                GoReadRelator<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>
+            ReadRelatorDecrementScale = {
+                Comparison<AssociativeReadPositional<Correlative, Evaluative>>,
+                BeginReadDecrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                TraverseReadDecrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                GoReadRelator<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Evaluative>
+            ReadElementIncrementScale = {
+                Comparison<AssociativeReadPositional<Correlative, Evaluative>>,
+                BeginReadIncrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                TraverseReadIncrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                GoReadElement<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Evaluative>
+            ReadElementDecrementScale = {
+                Comparison<AssociativeReadPositional<Correlative, Evaluative>>,
+                BeginReadDecrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                TraverseReadDecrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                GoReadElement<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeWritePositional<Correlative, Evaluative>, Natural, Evaluative>
+            WriteElementIncrementScale = {
+                Comparison<AssociativeWritePositional<Correlative, Evaluative>>,
+                BeginWriteIncrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                TraverseWriteIncrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                GoWriteElement<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Scalar<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeWritePositional<Correlative, Evaluative>, Natural, Evaluative>
+            WriteElementDecrementScale = {
+                Comparison<AssociativeWritePositional<Correlative, Evaluative>>,
+                BeginWriteDecrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                TraverseWriteDecrement<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                GoWriteElement<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Lineal<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>
+            ReadRelatorLiner = {
+                ReadRelatorIncrementScale<Natural, Inline, Correlative, Evaluative>,
+                ReadRelatorDecrementScale<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Lineal<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Evaluative>
+            ReadElementLiner = {
+                ReadElementIncrementScale<Natural, Inline, Correlative, Evaluative>,
+                ReadElementDecrementScale<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative>
+        constexpr Lineal<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeWritePositional<Correlative, Evaluative>, Natural, Evaluative>
+            WriteElementLiner = {
+                WriteElementIncrementScale<Natural, Inline, Correlative, Evaluative>,
+                WriteElementDecrementScale<Natural, Inline, Correlative, Evaluative>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            const bool Safety>
+        static inline bool
+        Correspond(
+            Referential<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            using MapPositional = AssociativeReadPositional<Correlative, Evaluative>;
+            static const Natural Before = 0;
+            MapPositional position;
+            if (Account(map) < 1)
+                return false;
+            Liner.increment.begin(map, position, 0);
+            return SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Precedent<Natural, Inline, Complementary<Correlative, Evaluative>>> Precede,
+            Referential<Precedent<Natural, Inline, Complementary<Correlative, Evaluative>>> Cede,
+            Referential<Consequent<Natural, Inline, Complementary<Correlative, Evaluative>>> Proceed,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            const bool Safety>
+        static inline bool
+        Associate(
+            Referential<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator,
+            Referential<const Evaluative>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            using MapComplementary = Complementary<Correlative, Evaluative>;
+            using MapPositional = AssociativeReadPositional<Correlative, Evaluative>;
+            static const Natural Before = 0;
+            const MapComplementary pair = { relator, value };
+            MapPositional position;
+            if (Account(map) < 1)
+                return Proceed(map, pair);
+            Liner.increment.begin(map, position, 0);
+            if (SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order) && Safety)
+                return false;
+            if (Order(Liner.increment.go(map, position).to, relator))
+                return Cede(map, position, pair);
+            return Precede(map, position, pair);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            Referential<MemoryMoving<Natural, Complementary<Correlative, Evaluative>>> Move,
+            const bool Safety>
+        static inline bool
+        Reassociate(
+            Referential<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                original,
+            Referential<const Correlative>
+                replacement)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            using ReadMapPositional = AssociativeReadPositional<Correlative, Evaluative>;
+            using WriteMapPositional = AssociativeWritePositional<Correlative, Evaluative>;
+            static const Natural Before = 0;
+            ReadMapPositional original_position, replacement_position;
+            Natural extent;
+            if (Safety && Account(map) < 1)
+                return false;
+            Liner.increment.begin(map, original_position, 0);
+            Liner.increment.begin(map, replacement_position, 0);
+            extent = Account(map) - 1;
+            if (!SearchBisection(map, Liner, original, original_position, Before, extent, Equate, Order) && Safety)
+                return false;
+            if (SearchBisection(map, Liner, replacement, replacement_position, Before, extent, Equate, Order) && Safety)
+                return false;
+            const Evaluative value = original_position->value;
+            WriteMapPositional write_position = const_cast<WriteMapPositional>(replacement_position);
+            if (replacement_position < original_position) {
+                const Natural delta = static_cast<Natural>(original_position - replacement_position);
+                if (!Move(write_position, write_position + 1, delta) && Safety)
+                    return false;
+            } else {
+                const WriteMapPositional first = const_cast<WriteMapPositional>(original_position);
+                const Natural delta = static_cast<Natural>(replacement_position - original_position);
+                if (!Move(first + 1, first, delta) && Safety)
+                    return false;
+            }
+            write_position->relator = replacement;
+            write_position->value = value;
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Concessive<Natural, Inline, Complementary<Correlative, Evaluative>>> Concede,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const Lineal<const AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, AssociativeReadPositional<Correlative, Evaluative>, Natural, const Correlative>> Liner,
+            const bool Safety>
+        static inline bool
+        Disassociate(
+            Referential<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>>
+                map,
+            Referential<const Correlative>
+                relator)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            using MapPositional = AssociativeReadPositional<Correlative, Evaluative>;
+            static const Natural Before = 0;
+            MapPositional position;
+            if (Safety && Account(map) < 1)
+                return false;
+            Liner.increment.begin(map, position, 0);
+            if (!SearchBisection(map, Liner, relator, position, Before, (Natural) (Account(map) - 1), Equate, Order) && Safety)
+                return false;
+            return Concede(map, position, 1);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const ArrayAllocative<Natural, Complementary<Correlative, Evaluative>>> Allocator,
+            Referential<MemoryMoving<Natural, Complementary<Correlative, Evaluative>>> Move>
+        constexpr Associative<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, Natural, Correlative, Evaluative>
+            FastAssociator = {
+                Antecede<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, false>,
+                Account<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                Correspond<Natural, Inline, Correlative, Evaluative, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, false>,
+                Associate<Natural, Inline, Correlative, Evaluative, Precede<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, false>, Cede<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, false>, Proceed<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, false>, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, false>,
+                Reassociate<Natural, Inline, Correlative, Evaluative, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, Move, false>,
+                Disassociate<Natural, Inline, Correlative, Evaluative, Concede<Natural, Inline, Complementary<Correlative, Evaluative>, Move, false>, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, false>,
+                Secede<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                Condense<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Correlative,
+            typename Evaluative,
+            Referential<Assortive<Correlative>> Equate,
+            Referential<Assortive<Correlative>> Order,
+            Referential<const ArrayAllocative<Natural, Complementary<Correlative, Evaluative>>> Allocator,
+            Referential<MemoryMoving<Natural, Complementary<Correlative, Evaluative>>> Move>
+        constexpr Associative<AssociativelyExpansive<Natural, Inline, Correlative, Evaluative>, Natural, Correlative, Evaluative>
+            SureAssociator = {
+                Antecede<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, true>,
+                Account<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                Correspond<Natural, Inline, Correlative, Evaluative, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, true>,
+                Associate<Natural, Inline, Correlative, Evaluative, Precede<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, true>, Cede<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, true>, Proceed<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move, true>, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, true>,
+                Reassociate<Natural, Inline, Correlative, Evaluative, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, Move, true>,
+                Disassociate<Natural, Inline, Correlative, Evaluative, Concede<Natural, Inline, Complementary<Correlative, Evaluative>, Move, true>, Equate, Order, ReadRelatorLiner<Natural, Inline, Correlative, Evaluative>, true>,
+                Secede<Natural, Inline, Complementary<Correlative, Evaluative>>,
+                Condense<Natural, Inline, Complementary<Correlative, Evaluative>, Allocator, Move>
+            };
+
+    }
+
+}
+
+}
+
+#endif
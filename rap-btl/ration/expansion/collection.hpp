@@ -0,0 +1,287 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_EXPANSION_COLLECTION_MODULE
+#define RATION_EXPANSION_COLLECTION_MODULE
+#include <composition.hpp>
+#include <ration/expansion.hpp>
+#include <sortation.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+namespace expansion {
+
+    /**
+     * @brief
+     *     Growable array sorted set management implementation.
+     * @details
+     *     Growable array sorted set management implementation.
+     */
+    namespace collection {
+
+        using ::composition::Compositional;
+        using ::location::Referential;
+        using ::sortation::Assortive;
+        using ::sortation::SearchBisection;
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<Assortive<Elemental>> Order,
+            Referential<const Lineal<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
+            const bool Safety>
+        static inline bool
+        AccreditCollection(
+            Referential<const Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static const Natural Before = 0;
+            ReadPositional<Elemental> position;
+            if (Account(set) < 1)
+                return false;
+            Liner.increment.begin(set, position, 0);
+            return SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Precedent<Natural, Inline, Elemental>> Precede,
+            Referential<Precedent<Natural, Inline, Elemental>> Cede,
+            Referential<Consequent<Natural, Inline, Elemental>> Proceed,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<Assortive<Elemental>> Order,
+            Referential<const Lineal<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
+            const bool Safety>
+        static inline bool
+        ComposeCollection(
+            Referential<Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static const Natural Before = 0;
+            ReadPositional<Elemental> position;
+            if (Account(set) < 1)
+                return Proceed(set, value);
+            Liner.increment.begin(set, position, 0);
+            if (SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order) && Safety)
+                return false;
+            if (Order(Liner.increment.go(set, position).to, value))
+                return Cede(set, position, value);
+            return Precede(set, position, value);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Concessive<Natural, Inline, Elemental>> Concede,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<Assortive<Elemental>> Order,
+            Referential<const Lineal<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
+            const bool Safety>
+        static inline bool
+        DiscomposeCollection(
+            Referential<Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static const Natural Before = 0;
+            ReadPositional<Elemental> position;
+            if (Safety && Account(set) < 1)
+                return false;
+            Liner.increment.begin(set, position, 0);
+            if (!SearchBisection(set, Liner, value, position, Before, (Natural) (Account(set) - 1), Equate, Order) && Safety)
+                return false;
+            return Concede(set, position, 1);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<Assortive<Elemental>> Order,
+            Referential<const Lineal<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Liner,
+            Referential<MemoryMoving<Natural, Elemental>> Move,
+            const bool Safety>
+        static inline bool
+        RecomposeCollection(
+            Referential<Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                original,
+            Referential<const Elemental>
+                replacement)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            static const Natural Before = 0;
+            ReadPositional<Elemental> original_position, replacement_position;
+            if (Safety && Account(set) < 1)
+                return false;
+            const Natural extent = Account(set) - 1;
+            Liner.increment.begin(set, original_position, 0);
+            if (!SearchBisection(set, Liner, original, original_position, Before, extent, Equate, Order) && Safety)
+                return false;
+            Liner.increment.begin(set, replacement_position, 0);
+            if (SearchBisection(set, Liner, replacement, replacement_position, Before, extent, Equate, Order) && Safety)
+                return false;
+            const WritePositional<Elemental> write_position = const_cast<WritePositional<Elemental>>(replacement_position);
+            if (replacement_position < original_position) {
+                const Natural delta = static_cast<Natural>(original_position - replacement_position);
+                if (!Move(write_position, write_position + 1, delta) && Safety)
+                    return false;
+            } else {
+                const WritePositional<Elemental> first = const_cast<WritePositional<Elemental>>(original_position);
+                const Natural delta = static_cast<Natural>(replacement_position - original_position);
+                if (!Move(first + 1, first, delta) && Safety)
+                    return false;
+            }
+            Refer(write_position).to = replacement;
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<Assortive<Elemental>> Order,
+            Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+            Referential<MemoryMoving<Natural, Elemental>> Move = RelocateElements<Natural, Elemental>>
+        constexpr Compositional<Expansive<Natural, Inline, Elemental>, Natural, Elemental>
+            FastOrderedComposer = {
+                Antecede<Natural, Inline, Elemental, Allocator, Move, false>,
+                AccreditCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    false>,
+                ComposeCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Precede<Natural, Inline, Elemental, Allocator, Move, false>,
+                    Cede<Natural, Inline, Elemental, Allocator, Move, false>,
+                    Proceed<Natural, Inline, Elemental, Allocator, Move, false>,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    false>,
+                RecomposeCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    Move,
+                    false>,
+                DiscomposeCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Concede<Natural, Inline, Elemental, Move, false>,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    false>,
+                Secede<Natural, Inline, Elemental>,
+                Condense<Natural, Inline, Elemental, Allocator, Move>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<Assortive<Elemental>> Order,
+            Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+            Referential<MemoryMoving<Natural, Elemental>> Move = RelocateElements<Natural, Elemental>>
+        constexpr Compositional<Expansive<Natural, Inline, Elemental>, Natural, Elemental>
+            SureOrderedComposer = {
+                Antecede<Natural, Inline, Elemental, Allocator, Move, true>,
+                AccreditCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    true>,
+                ComposeCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Precede<Natural, Inline, Elemental, Allocator, Move, true>,
+                    Cede<Natural, Inline, Elemental, Allocator, Move, true>,
+                    Proceed<Natural, Inline, Elemental, Allocator, Move, true>,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    true>,
+                RecomposeCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    Move,
+                    true>,
+                DiscomposeCollection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Concede<Natural, Inline, Elemental, Move, true>,
+                    Equate,
+                    Order,
+                    ReadLiner<Natural, Inline, Elemental>,
+                    true>,
+                Secede<Natural, Inline, Elemental>,
+                Condense<Natural, Inline, Elemental, Allocator, Move>
+            };
+
+    }
+
+}
+
+}
+
+#endif
@@ -0,0 +1,249 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_EXPANSION_SELECTION_MODULE
+#define RATION_EXPANSION_SELECTION_MODULE
+#include <composition.hpp>
+#include <ration/expansion.hpp>
+#include <sortation.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+namespace expansion {
+
+    /**
+     * @brief
+     *     Growable array set management implementation.
+     * @details
+     *     Growable array set management implementation.
+     */
+    namespace selection {
+
+        using ::composition::Compositional;
+        using ::location::Referential;
+        using ::sortation::Assortive;
+        using ::sortation::SearchSection;
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<const Scalar<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Scale,
+            const bool Safety>
+        static inline bool
+        AccreditSelection(
+            Referential<const Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            ReadPositional<Elemental> position;
+            if (Account(set) < 1)
+                return false;
+            Scale.begin(set, position, 0);
+            return SearchSection(set, Scale, value, position, (Natural) (Account(set) - 1), Equate);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Consequent<Natural, Inline, Elemental>> Proceed,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<const Scalar<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Scale,
+            const bool Safety>
+        static inline bool
+        ComposeSelection(
+            Referential<Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            ReadPositional<Elemental> position;
+            if (Safety && Account(set) > 0) {
+                Scale.begin(set, position, 0);
+                if (SearchSection(set, Scale, value, position, (Natural) (Account(set) - 1), Equate))
+                    return false;
+            }
+            return Proceed(set, value);
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Concessive<Natural, Inline, Elemental>> Concede,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<const Scalar<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Scale,
+            const bool Safety>
+        static inline bool
+        DiscomposeSelection(
+            Referential<Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                value)
+        {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            ReadPositional<Elemental> position;
+            if (Safety && Account(set) < 1)
+                return false;
+            Scale.begin(set, position, 0);
+            if (SearchSection(set, Scale, value, position, (Natural) (Account(set) - 1), Equate))
+                return Concede(set, position, 1);
+            return false;
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<const Scalar<const Expansive<Natural, Inline, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>> Scale,
+            const bool Safety>
+        static inline bool
+        RecomposeSelection(
+            Referential<Expansive<Natural, Inline, Elemental>>
+                set,
+            Referential<const Elemental>
+                original,
+            Referential<const Elemental>
+                replacement)
+        {
+            using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+            using namespace ::std;
+            static_assert(
+                is_integral<Natural>::value && is_unsigned<Natural>::value,
+                "Natural:  Unsigned integer type required");
+#endif
+            ReadPositional<Elemental> position;
+            if (Safety && Account(set) < 1)
+                return false;
+            const Natural extent = Account(set) - 1;
+            if (Safety) {
+                Scale.begin(set, position, 0);
+                if (SearchSection(set, Scale, replacement, position, extent, Equate))
+                    return false;
+            }
+            Scale.begin(set, position, 0);
+            if (!SearchSection(set, Scale, original, position, extent, Equate) && Safety)
+                return false;
+            Refer(const_cast<WritePositional<Elemental>>(position)).to = replacement;
+            return true;
+        }
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+            Referential<MemoryMoving<Natural, Elemental>> Move>
+        constexpr Compositional<Expansive<Natural, Inline, Elemental>, Natural, Elemental>
+            FastComposer = {
+                Antecede<Natural, Inline, Elemental, Allocator, Move, false>,
+                AccreditSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    false>,
+                ComposeSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Proceed<Natural, Inline, Elemental, Allocator, Move, false>,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    false>,
+                RecomposeSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    false>,
+                DiscomposeSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Concede<Natural, Inline, Elemental, Move, false>,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    false>,
+                Secede<Natural, Inline, Elemental>,
+                Condense<Natural, Inline, Elemental, Allocator, Move>
+            };
+
+        template <
+            typename Natural,
+            Natural Inline,
+            typename Elemental,
+            Referential<Assortive<Elemental>> Equate,
+            Referential<const ArrayAllocative<Natural, Elemental>> Allocator,
+            Referential<MemoryMoving<Natural, Elemental>> Move>
+        constexpr Compositional<Expansive<Natural, Inline, Elemental>, Natural, Elemental>
+            SureComposer = {
+                Antecede<Natural, Inline, Elemental, Allocator, Move, true>,
+                AccreditSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    true>,
+                ComposeSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Proceed<Natural, Inline, Elemental, Allocator, Move, true>,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    true>,
+                RecomposeSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    true>,
+                DiscomposeSelection<
+                    Natural,
+                    Inline,
+                    Elemental,
+                    Concede<Natural, Inline, Elemental, Move, true>,
+                    Equate,
+                    ReadIncrementScale<Natural, Inline, Elemental>,
+                    true>,
+                Secede<Natural, Inline, Elemental>,
+                Condense<Natural, Inline, Elemental, Allocator, Move>
+            };
+
+    }
+
+}
+
+}
+
+#endif
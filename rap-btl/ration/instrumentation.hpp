@@ -0,0 +1,56 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_INSTRUMENTATION_MODULE
+#define RATION_INSTRUMENTATION_MODULE
+#include <instrumentation.hpp>
+#include <ration.hpp>
+
+namespace ration {
+
+/**
+ * @brief
+ *     Array sequence memory move instrumentation.
+ * @details
+ *     Memory moving function which records the number of elements moved by
+ *     the memory moving function it wraps, so that ration objectives which
+ *     shift elements on insertion and removal can be found.  Unless
+ *     RAPBTL_INSTRUMENTATION is defined, it simply forwards to the function
+ *     it wraps.
+ */
+namespace instrumentation {
+
+    using ::instrumentation::Instrumental;
+    using ::location::Locational;
+    using ::location::Referential;
+
+    template <
+        typename Natural,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    Transfer(
+        Locational<Elemental>
+            from,
+        Locational<Elemental>
+            to,
+        Natural
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+#ifdef RAPBTL_INSTRUMENTATION
+        Record.moves += count;
+#endif
+        return Move(from, to, count);
+    }
+
+}
+
+}
+
+#endif
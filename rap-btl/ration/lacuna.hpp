@@ -0,0 +1,1652 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_LACUNA_MODULE
+#define RATION_LACUNA_MODULE
+#include <consecution.hpp>
+#include <ration.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <type_traits>
+#endif
+
+namespace ration {
+
+/**
+ * @brief
+ *     Gap buffer sequence management implementation.
+ * @details
+ *     Array sequence management implementation which keeps the unallotted
+ *     elements of the array as a gap at the point of the last insertion or
+ *     removal.  Elements before the gap are kept at the beginning of the
+ *     array and elements after it at the end of the array, so that
+ *     inserting or removing at the same point again only moves the gap
+ *     boundary and costs constant time.  Editing elsewhere first moves the
+ *     elements between the gap and the new point across the gap.  Scales
+ *     skip the gap, and positions are invalidated whenever the sequence is
+ *     modified.
+ */
+namespace lacuna {
+
+    using ::comparison::Comparison;
+    using ::consecution::Conjoint;
+    using ::consecution::Sequent;
+    using ::location::Conferential;
+    using ::location::Locational;
+    using ::location::Referential;
+    using ::trajection::Axial;
+    using ::trajection::Directional;
+    using ::trajection::Lineal;
+    using ::trajection::Scalar;
+
+    /**
+     * @brief
+     *     Gap buffer memory resource conformity.
+     * @details
+     *     Type definition which contains the number of elements before and
+     *     after the gap and the array of memory elements.  The elements
+     *     before the gap occupy the beginning of the array and the elements
+     *     after the gap occupy the end of the array.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    struct Lacunary {
+
+        Natural
+            front, /**< Number of elements before the gap. */
+            back; /**< Number of elements after the gap. */
+
+        Elemental
+            source[Maximum]; /**< Array of memory elements to be rationed. */
+    };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    using Consequent = bool(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value);
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    using Precedent = bool(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value);
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    using Concessive = bool(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Natural>
+            count);
+
+    /**
+     * @brief
+     *     Initialized gap buffer.
+     * @details
+     *     Initialized gap buffer value which can be used to initialize an
+     *     instance of the same gap buffer type.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Lacunary<Natural, Maximum, Elemental>
+        InitializedLacuna = { 0, 0 };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<Lacunary<Natural, Maximum, Elemental>>
+    Initialize(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        sequence.front = sequence.back = 0;
+        return sequence;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    Account(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return sequence.front + sequence.back;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    Gap(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Maximum - sequence.front - sequence.back;
+    }
+
+    /**
+     * @brief
+     *     Locates an element by its index.
+     * @details
+     *     Provides the position of the element at the specified index
+     *     within the sequence, skipping the gap.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @param[in] sequence
+     *     Reference to the gap buffer.
+     * @param[in] index
+     *     Index of the element within the sequence.
+     * @return
+     *     Position of the element.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline ReadPositional<Elemental>
+    Locate(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        const Natural
+            index)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (index < sequence.front)
+            return sequence.source + index;
+        return sequence.source + index + Gap(sequence);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline WritePositional<Elemental>
+    Locate(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        const Natural
+            index)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (index < sequence.front)
+            return sequence.source + index;
+        return sequence.source + index + Gap(sequence);
+    }
+
+    /**
+     * @brief
+     *     Indexes an element by its position.
+     * @details
+     *     Provides the index within the sequence of the element at the
+     *     specified position, discounting the gap.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @param[in] sequence
+     *     Reference to the gap buffer.
+     * @param[in] position
+     *     Position of the element.
+     * @return
+     *     Index of the element within the sequence.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    Index(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural offset = static_cast<Natural>(position - sequence.source);
+        if (offset < sequence.front)
+            return offset;
+        return offset - Gap(sequence);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Meets(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (sequence.source <= position && position < sequence.source + sequence.front)
+            return true;
+        return sequence.source + Maximum - sequence.back <= position && position < sequence.source + Maximum;
+    }
+
+    /**
+     * @brief
+     *     Moves the gap to an index.
+     * @details
+     *     Moves the elements between the gap and the specified index across
+     *     the gap, so that the gap begins at that index.  The cost is
+     *     proportional to the distance the gap moves.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @param[in,out] sequence
+     *     Reference to the gap buffer.
+     * @param[in] index
+     *     Index within the sequence at which the gap is to begin.
+     * @return
+     *     True if the gap was moved.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    static inline bool
+    Shift(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        const Natural
+            index)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural gap = Gap(sequence);
+        if (index < sequence.front) {
+            const Natural count = sequence.front - index;
+            if (gap > 0 && !Move(sequence.source + index, sequence.source + index + gap, count))
+                return false;
+            sequence.front -= count;
+            sequence.back += count;
+        } else if (index > sequence.front) {
+            const Natural count = index - sequence.front;
+            if (gap > 0 && !Move(sequence.source + sequence.front + gap, sequence.source + sequence.front, count))
+                return false;
+            sequence.front += count;
+            sequence.back -= count;
+        }
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Removes a run of elements.
+     * @details
+     *     Removes count elements beginning at the specified index by
+     *     widening the gap over them, moving the gap to whichever end of
+     *     the run is nearest first.  No elements are moved if the gap
+     *     already borders or lies within the run.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @param[in,out] sequence
+     *     Reference to the gap buffer.
+     * @param[in] index
+     *     Index within the sequence of the first element to remove.
+     * @param[in] count
+     *     Number of elements to remove.
+     * @return
+     *     True if the elements were removed.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    static inline bool
+    Excise(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        const Natural
+            index,
+        const Natural
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural end = index + count;
+        if (sequence.front <= index) {
+            if (!Shift<Natural, Maximum, Elemental, Move>(sequence, index))
+                return false;
+            sequence.back -= count;
+        } else if (sequence.front >= end) {
+            if (!Shift<Natural, Maximum, Elemental, Move>(sequence, end))
+                return false;
+            sequence.front -= count;
+        } else {
+            sequence.back -= end - sequence.front;
+            sequence.front = index;
+        }
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    CountReadIncrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Account(sequence) - 1 - Index(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    CountWriteIncrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Account(sequence) - 1 - Index<Natural, Maximum, Elemental>(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    CountReadDecrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Index(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Natural
+    CountWriteDecrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Index<Natural, Maximum, Elemental>(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Begins(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return count < Account(sequence);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    ReadMeets(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Meets(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    WriteMeets(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Meets<Natural, Maximum, Elemental>(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Conferential<Elemental>
+    GoWrite(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Refer(position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Conferential<const Elemental>
+    GoRead(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position)
+    {
+        using namespace ::location;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Refer(position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    BeginReadIncrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Locate(sequence, count);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    BeginWriteIncrement(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Locate(sequence, count);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    ReadIncrementTraverses(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Account(sequence) < 1)
+            return false;
+        return count <= CountReadIncrement(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    WriteIncrementTraverses(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Account(sequence) < 1)
+            return false;
+        return count <= CountWriteIncrement(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    TraverseReadIncrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural offset = static_cast<Natural>(position - sequence.source);
+        if (offset < sequence.front && count >= sequence.front - offset)
+            return position += count + Gap(sequence);
+        return position += count;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    TraverseWriteIncrement(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural offset = static_cast<Natural>(position - sequence.source);
+        if (offset < sequence.front && count >= sequence.front - offset)
+            return position += count + Gap(sequence);
+        return position += count;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    BeginReadDecrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Locate(sequence, static_cast<Natural>(Account(sequence) - count - 1));
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    BeginWriteDecrement(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return position = Locate(sequence, static_cast<Natural>(Account(sequence) - count - 1));
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    ReadDecrementTraverses(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Account(sequence) < 1)
+            return false;
+        return count <= CountReadDecrement(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    WriteDecrementTraverses(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Account(sequence) < 1)
+            return false;
+        return count <= CountWriteDecrement(sequence, position);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const ReadPositional<Elemental>>
+    TraverseReadDecrement(
+        Referential<const Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<ReadPositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural offset = static_cast<Natural>(position - sequence.source);
+        const Natural after = Maximum - sequence.back;
+        if (offset >= after && count > offset - after)
+            return position -= count + Gap(sequence);
+        return position -= count;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline Referential<const WritePositional<Elemental>>
+    TraverseWriteDecrement(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<WritePositional<Elemental>>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural offset = static_cast<Natural>(position - sequence.source);
+        const Natural after = Maximum - sequence.back;
+        if (offset >= after && count > offset - after)
+            return position -= count + Gap(sequence);
+        return position -= count;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        const bool Safety>
+    static inline bool
+    Antecede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Gap(sequence) >= count;
+    }
+
+    /**
+     * @brief
+     *     Inserts an element at an index.
+     * @details
+     *     Moves the gap to the specified index and places the element at
+     *     the beginning of the gap.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @tparam Safety
+     *     Whether the array is checked for room.
+     * @param[in,out] sequence
+     *     Reference to the gap buffer.
+     * @param[in] index
+     *     Index within the sequence at which the element is inserted.
+     * @param[in] value
+     *     Value of the element to insert.
+     * @return
+     *     True if the element was inserted.
+     */
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Interpose(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        const Natural
+            index,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && Gap(sequence) < 1)
+            return false;
+        if (!Shift<Natural, Maximum, Elemental, Move>(sequence, index) && Safety)
+            return false;
+        sequence.source[sequence.front++] = value;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Inserts a range of elements at an index.
+     * @details
+     *     Moves the gap to the specified index and fills the beginning of
+     *     the gap from the range of elements in the relative space.
+     * @tparam Relative
+     *     Type of the relative space.
+     * @tparam Appositional
+     *     Type of positions in the relative space.
+     * @tparam RelativeNatural
+     *     Type of natural integer of the relative space.
+     * @tparam Natural
+     *     Type of natural integer used to track allotments.
+     * @tparam Maximum
+     *     The maximum number of elements and size of the array.
+     * @tparam Elemental
+     *     Type of the rationed memory elements.
+     * @tparam Move
+     *     Reference to the memory moving function.
+     * @tparam Safety
+     *     Whether the array is checked for room.
+     * @param[in,out] sequence
+     *     Reference to the gap buffer.
+     * @param[in] index
+     *     Index within the sequence at which the elements are inserted.
+     * @param[in] direction
+     *     Reference to the direction objective of the relative space.
+     * @param[in] space
+     *     Reference to the relative space.
+     * @param[in] from
+     *     Position of the first element of the range.
+     * @param[in] to
+     *     Position of the last element of the range.
+     * @return
+     *     True if the elements were inserted.
+     */
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Interpose(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        const Natural
+            index,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        Appositional apposition = from;
+        Natural count = 1;
+        while (direction.scale.order.equality.is_not_equal(apposition, to)) {
+            if (Safety && !direction.traverses(space, apposition, 1))
+                return false;
+            direction.scale.traverse(space, apposition, 1);
+            count++;
+        }
+        if (Safety && count > Gap(sequence))
+            return false;
+        if (!Shift<Natural, Maximum, Elemental, Move>(sequence, index) && Safety)
+            return false;
+        apposition = from;
+        for (Natural offset = 0; offset < count; offset++) {
+            sequence.source[sequence.front++] = direction.scale.go(space, apposition).to;
+            direction.scale.traverse(space, apposition, 1);
+        }
+        return true;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Interpose<Natural, Maximum, Elemental, Move, Safety>(sequence, 0, value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Accede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, Safety>(sequence, 0, direction, space, from, to);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Precede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && !Meets(sequence, rank))
+            return false;
+        return Interpose<Natural, Maximum, Elemental, Move, Safety>(sequence, Index(sequence, rank), value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Precede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        if (Safety && !Meets(sequence, rank))
+            return false;
+        return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, Safety>(sequence, Index(sequence, rank), direction, space, from, to);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Cede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && !Meets(sequence, rank))
+            return false;
+        return Interpose<Natural, Maximum, Elemental, Move, Safety>(sequence, Index(sequence, rank) + 1, value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Cede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        if (Safety && !Meets(sequence, rank))
+            return false;
+        return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, Safety>(sequence, Index(sequence, rank) + 1, direction, space, from, to);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Elemental>
+            value)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        return Interpose<Natural, Maximum, Elemental, Move, Safety>(sequence, Account(sequence), value);
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Proceed(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Directional<const Relative, Appositional, RelativeNatural, const Elemental>>
+            direction,
+        Referential<const Relative>
+            space,
+        Referential<const Appositional>
+            from,
+        Referential<const Appositional>
+            to)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+            "RelativeNatural:  Unsigned integer type required");
+#endif
+        return Interpose<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, Safety>(sequence, Account(sequence), direction, space, from, to);
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Succeed(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && count > Account(sequence))
+            return false;
+        return Excise<Natural, Maximum, Elemental, Move>(sequence, 0, count) || !Safety;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Supersede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && !Meets(sequence, rank))
+            return false;
+        const Natural end = Index(sequence, rank) + 1;
+        if (Safety && end < count)
+            return false;
+        return Excise<Natural, Maximum, Elemental, Move>(sequence, end - count, count) || !Safety;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Concede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const ReadPositional<Elemental>>
+            rank,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && !Meets(sequence, rank))
+            return false;
+        const Natural index = Index(sequence, rank);
+        if (Safety && count > Account(sequence) - index)
+            return false;
+        return Excise<Natural, Maximum, Elemental, Move>(sequence, index, count) || !Safety;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move,
+        const bool Safety>
+    static inline bool
+    Recede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        if (Safety && count > Account(sequence))
+            return false;
+        return Excise<Natural, Maximum, Elemental, Move>(sequence, Account(sequence) - count, count) || !Safety;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Condense(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence)
+    {
+        return false;
+    }
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    static inline bool
+    Secede(
+        Referential<Lacunary<Natural, Maximum, Elemental>>
+            sequence)
+    {
+        const bool actioned = Account(sequence) != 0;
+        sequence.front = sequence.back = 0;
+        return actioned;
+    }
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Conjoint<Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Relative, Appositional, RelativeNatural, Elemental>
+        FastConjoiner = {
+            Accede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, false>,
+            Precede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, false>,
+            Cede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, false>,
+            Proceed<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, false>
+        };
+
+    template <
+        typename Relative,
+        typename Appositional,
+        typename RelativeNatural,
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Conjoint<Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Relative, Appositional, RelativeNatural, Elemental>
+        SureConjoiner = {
+            Accede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, true>,
+            Precede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, true>,
+            Cede<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, true>,
+            Proceed<Relative, Appositional, RelativeNatural, Natural, Maximum, Elemental, Move, true>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Sequent<Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, Elemental>
+        FastSequencer = {
+            Antecede<Natural, Maximum, Elemental, false>,
+            Account<Natural, Maximum, Elemental>,
+            Accede<Natural, Maximum, Elemental, Move, false>,
+            Precede<Natural, Maximum, Elemental, Move, false>,
+            Cede<Natural, Maximum, Elemental, Move, false>,
+            Proceed<Natural, Maximum, Elemental, Move, false>,
+            Succeed<Natural, Maximum, Elemental, Move, false>,
+            Supersede<Natural, Maximum, Elemental, Move, false>,
+            Concede<Natural, Maximum, Elemental, Move, false>,
+            Recede<Natural, Maximum, Elemental, Move, false>,
+            Secede<Natural, Maximum, Elemental>,
+            Condense<Natural, Maximum, Elemental>,
+            FastConjoiner<Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, Natural, Maximum, Elemental, Move>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental,
+        Referential<MemoryMoving<Natural, Elemental>> Move>
+    constexpr Sequent<Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, Elemental>
+        SureSequencer = {
+            Antecede<Natural, Maximum, Elemental, true>,
+            Account<Natural, Maximum, Elemental>,
+            Accede<Natural, Maximum, Elemental, Move, true>,
+            Precede<Natural, Maximum, Elemental, Move, true>,
+            Cede<Natural, Maximum, Elemental, Move, true>,
+            Proceed<Natural, Maximum, Elemental, Move, true>,
+            Succeed<Natural, Maximum, Elemental, Move, true>,
+            Supersede<Natural, Maximum, Elemental, Move, true>,
+            Concede<Natural, Maximum, Elemental, Move, true>,
+            Recede<Natural, Maximum, Elemental, Move, true>,
+            Secede<Natural, Maximum, Elemental>,
+            Condense<Natural, Maximum, Elemental>,
+            SureConjoiner<Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, Natural, Maximum, Elemental, Move>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Scalar<const Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementScale = {
+            Comparison<ReadPositional<Elemental>>,
+            BeginReadIncrement<Natural, Maximum, Elemental>,
+            TraverseReadIncrement<Natural, Maximum, Elemental>,
+            GoRead<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Scalar<Lacunary<Natural, Maximum, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteIncrementScale = {
+            Comparison<WritePositional<Elemental>>,
+            BeginWriteIncrement<Natural, Maximum, Elemental>,
+            TraverseWriteIncrement<Natural, Maximum, Elemental>,
+            GoWrite<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Scalar<const Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadDecrementScale = {
+            Comparison<ReadPositional<Elemental>>,
+            BeginReadDecrement<Natural, Maximum, Elemental>,
+            TraverseReadDecrement<Natural, Maximum, Elemental>,
+            GoRead<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Scalar<Lacunary<Natural, Maximum, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteDecrementScale = {
+            Comparison<WritePositional<Elemental>>,
+            BeginWriteDecrement<Natural, Maximum, Elemental>,
+            TraverseWriteDecrement<Natural, Maximum, Elemental>,
+            GoWrite<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Lineal<const Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadLiner = {
+            ReadIncrementScale<Natural, Maximum, Elemental>,
+            ReadDecrementScale<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Lineal<Lacunary<Natural, Maximum, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteLiner = {
+            WriteIncrementScale<Natural, Maximum, Elemental>,
+            WriteDecrementScale<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Directional<const Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadIncrementDirection = {
+            ReadIncrementScale<Natural, Maximum, Elemental>,
+            Begins<Natural, Maximum, Elemental>,
+            ReadIncrementTraverses<Natural, Maximum, Elemental>,
+            ReadMeets<Natural, Maximum, Elemental>,
+            Account<Natural, Maximum, Elemental>,
+            CountReadIncrement<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Directional<Lacunary<Natural, Maximum, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteIncrementDirection = {
+            WriteIncrementScale<Natural, Maximum, Elemental>,
+            Begins<Natural, Maximum, Elemental>,
+            WriteIncrementTraverses<Natural, Maximum, Elemental>,
+            WriteMeets<Natural, Maximum, Elemental>,
+            Account<Natural, Maximum, Elemental>,
+            CountWriteIncrement<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Directional<const Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadDecrementDirection = {
+            ReadDecrementScale<Natural, Maximum, Elemental>,
+            Begins<Natural, Maximum, Elemental>,
+            ReadDecrementTraverses<Natural, Maximum, Elemental>,
+            ReadMeets<Natural, Maximum, Elemental>,
+            Account<Natural, Maximum, Elemental>,
+            CountReadDecrement<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Directional<Lacunary<Natural, Maximum, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteDecrementDirection = {
+            WriteDecrementScale<Natural, Maximum, Elemental>,
+            Begins<Natural, Maximum, Elemental>,
+            WriteDecrementTraverses<Natural, Maximum, Elemental>,
+            WriteMeets<Natural, Maximum, Elemental>,
+            Account<Natural, Maximum, Elemental>,
+            CountWriteDecrement<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Axial<const Lacunary<Natural, Maximum, Elemental>, ReadPositional<Elemental>, Natural, const Elemental>
+        ReadAxis = {
+            ReadIncrementDirection<Natural, Maximum, Elemental>,
+            ReadDecrementDirection<Natural, Maximum, Elemental>
+        };
+
+    template <
+        typename Natural,
+        Natural Maximum,
+        typename Elemental>
+    constexpr Axial<Lacunary<Natural, Maximum, Elemental>, WritePositional<Elemental>, Natural, Elemental>
+        WriteAxis = {
+            WriteIncrementDirection<Natural, Maximum, Elemental>,
+            WriteDecrementDirection<Natural, Maximum, Elemental>
+        };
+
+}
+
+}
+
+#endif
@@ -0,0 +1,212 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef RATION_VECTORIZATION_MODULE
+#define RATION_VECTORIZATION_MODULE
+#include <location.hpp>
+#include <ration.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#else
+extern "C" {
+#include <stdint.h>
+#include <string.h>
+}
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define RATION_VECTORIZATION_STREAMING
+#include <immintrin.h>
+#endif
+
+namespace ration {
+
+/**
+ * @brief
+ *     Array sequence memory move implementation using vectorized streaming
+ *     stores for large moves.
+ * @details
+ *     Implements the MemoryMoving function type for trivially copyable
+ *     elements.  Moves of at least a threshold number of bytes between
+ *     regions which do not overlap, such as those made when an expansion
+ *     is reallocated or a run is transferred between spaces, are copied in
+ *     vector blocks using non-temporal stores.  These write around the
+ *     processor caches instead of evicting their contents, so that moving
+ *     a large array does not displace the working set of the rest of the
+ *     process.  The block width is chosen when the process first streams
+ *     a region, using 32 byte AVX blocks when the processor supports them
+ *     and 16 byte SSE2 blocks otherwise.  All other moves, including the
+ *     overlapping shifts made when elements are inserted or removed, are
+ *     passed to the standard memmove function, since the lines they store
+ *     to have just been loaded into the caches and streaming to them only
+ *     forces their eviction.  Streaming stores are only used with compilers
+ *     which support the GNU target attribute on x86 processors.  The
+ *     streaming sequencers of the expansion module use this function to
+ *     move the elements of an expansion whenever its array is reclaimed.
+ */
+namespace vectorization {
+
+    using ::location::Locational;
+
+    /**
+     * @brief
+     *     Default streaming threshold.
+     * @details
+     *     Number of bytes at or above which a move between regions which do
+     *     not overlap is copied with streaming stores.  Moves of this size
+     *     exceed the private caches of most x86 processors, so little of the
+     *     destination would have remained cached.
+     */
+    constexpr size_t DefaultThreshold = 1 << 21;
+
+#ifdef RATION_VECTORIZATION_STREAMING
+
+    /**
+     * @brief
+     *     Copies bytes in 16 byte blocks using SSE2 streaming stores.
+     */
+    static inline void
+    StreamNarrow(
+        unsigned char*
+            to,
+        const unsigned char*
+            from,
+        size_t
+            bytes)
+    {
+        size_t head = (16 - reinterpret_cast<size_t>(to) % 16) % 16;
+        if (head > bytes)
+            head = bytes;
+        memmove(to, from, head);
+        to += head, from += head, bytes -= head;
+        for (; bytes >= 4 * 16; to += 4 * 16, from += 4 * 16, bytes -= 4 * 16) {
+            const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from));
+            const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + 16));
+            const __m128i third = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + 2 * 16));
+            const __m128i fourth = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + 3 * 16));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(to), first);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(to + 16), second);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(to + 2 * 16), third);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(to + 3 * 16), fourth);
+        }
+        for (; bytes >= 16; to += 16, from += 16, bytes -= 16)
+            _mm_stream_si128(reinterpret_cast<__m128i*>(to), _mm_loadu_si128(reinterpret_cast<const __m128i*>(from)));
+        memmove(to, from, bytes);
+    }
+
+    /**
+     * @brief
+     *     Copies bytes in 32 byte blocks using AVX streaming stores.
+     */
+    __attribute__((target("avx"))) static inline void
+    StreamWide(
+        unsigned char*
+            to,
+        const unsigned char*
+            from,
+        size_t
+            bytes)
+    {
+        size_t head = (32 - reinterpret_cast<size_t>(to) % 32) % 32;
+        if (head > bytes)
+            head = bytes;
+        memmove(to, from, head);
+        to += head, from += head, bytes -= head;
+        for (; bytes >= 4 * 32; to += 4 * 32, from += 4 * 32, bytes -= 4 * 32) {
+            const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from));
+            const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 32));
+            const __m256i third = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 2 * 32));
+            const __m256i fourth = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + 3 * 32));
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(to), first);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(to + 32), second);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(to + 2 * 32), third);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(to + 3 * 32), fourth);
+        }
+        for (; bytes >= 32; to += 32, from += 32, bytes -= 32)
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(to), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from)));
+        memmove(to, from, bytes);
+    }
+
+    /**
+     * @brief
+     *     Determines once whether the processor supports AVX.
+     */
+    static inline bool
+    Widened()
+    {
+        static const bool wide = __builtin_cpu_supports("avx");
+        return wide;
+    }
+
+#endif
+
+    /**
+     * @brief
+     *     Moves array elements using streaming stores above a threshold.
+     * @details
+     *     Moves count array elements from one position to another within an
+     *     array.  When the elements occupy at least the threshold number of
+     *     bytes and the regions do not overlap, they are copied in vector
+     *     blocks using non-temporal stores and a store fence is issued
+     *     before returning, otherwise they are moved using the standard
+     *     memmove function.  The elements must be trivially copyable.
+     * @tparam Natural
+     *     Type of natural integer.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Threshold
+     *     Number of bytes at or above which streaming stores are used.
+     * @param[in] from
+     *     Position to move the elements from.
+     * @param[in] to
+     *     Position to move the elements to.
+     * @param[in] count
+     *     Number of elements to move.
+     * @return
+     *     This implementation always returns true.
+     */
+    template <
+        typename Natural,
+        typename Elemental,
+        size_t Threshold = DefaultThreshold>
+    static inline bool
+    StreamBytes(
+        Locational<Elemental>
+            from,
+        Locational<Elemental>
+            to,
+        Natural
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            is_trivially_copyable<Elemental>::value,
+            "Elemental:  Trivially copyable type required");
+#endif
+        const size_t bytes = static_cast<size_t>(count) * sizeof(Elemental);
+#ifdef RATION_VECTORIZATION_STREAMING
+        const uintptr_t target = reinterpret_cast<uintptr_t>(to);
+        const uintptr_t source = reinterpret_cast<uintptr_t>(from);
+        if (bytes >= Threshold && (target >= source + bytes || source >= target + bytes)) {
+            if (Widened())
+                StreamWide(reinterpret_cast<unsigned char*>(to), reinterpret_cast<const unsigned char*>(from), bytes);
+            else
+                StreamNarrow(reinterpret_cast<unsigned char*>(to), reinterpret_cast<const unsigned char*>(from), bytes);
+            _mm_sfence();
+            return true;
+        }
+#endif
+        if (bytes > 0)
+            memmove(static_cast<void*>(to), static_cast<const void*>(from), bytes);
+        return true;
+    }
+
+}
+
+}
+
+#endif
@@ -554,7 +554,7 @@ template <
     typename Elemental>
 constexpr Directional<const Locational<Elemental>, Natural, Natural, Elemental>
     WriteIncrementDirection = {
-        WriteIncrementScale<Natural, Elemental>,
+        WriteIncrementScale<Natural, Natural, Elemental>,
         Begins<Natural, Length, Elemental>,
         IncrementTraverses<Natural, Length, Elemental>,
         ContainsIndex<Natural, Length, Elemental>,
@@ -10,16 +10,20 @@
 
 /**
  * @brief   
- *     Sequential and bisectional search implementations.
+ *     Sequential and bisectional search and segment sort implementations.
  * @details 
  *     Sequential and bisectional search algorithms which use specified
  *     trajection objectives corresponding to the spatial types being searched.
  *     Several versions of the algorithms are provided, being optimized for 
- *     either singular or iterative searches through spaces.
+ *     either singular or iterative searches through spaces.  Sorting is 
+ *     provided for contiguous memory segments, such as the source array of 
+ *     a ration resource or the memory referenced by a segmentation or 
+ *     localization space.
  */
 namespace sortation {
 
 using ::comparison::BinaryComparative;
+using ::location::Locational;
 using ::location::Referential;
 using ::trajection::Lineal;
 using ::trajection::Scalar;
@@ -853,6 +857,385 @@ SearchScalarBisection(
     return SearchScalarBisection(space, Scale, value, position, extent, Equate, Order);
 }
 
+/**
+ * @brief
+ *     Merges two sorted memory segments into a third memory segment.
+ * @details
+ *     The merge is stable, meaning that elements of the base segment are
+ *     placed before equivalent elements of the relative segment.  The 
+ *     target segment must not overlap either of the source segments and
+ *     must have room for the sum of both counts.  With this overload, the 
+ *     order objective is specified as a function argument.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[out] target
+ *     Pointer to the first element of the target segment.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first 
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+static inline void
+MergeSegments(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target,
+    Referential<Assortive<Elemental>>
+        order)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural base_index, relative_index, target_index;
+    base_index = relative_index = target_index = 0;
+    while (base_index < base_count && relative_index < relative_count) {
+        if (order(relative[relative_index], base[base_index]))
+            target[target_index++] = relative[relative_index++];
+        else
+            target[target_index++] = base[base_index++];
+    }
+    while (base_index < base_count)
+        target[target_index++] = base[base_index++];
+    while (relative_index < relative_count)
+        target[target_index++] = relative[relative_index++];
+}
+
+/**
+ * @brief
+ *     Merges two sorted memory segments into a third memory segment.
+ * @details
+ *     The merge is stable, meaning that elements of the base segment are
+ *     placed before equivalent elements of the relative segment.  The 
+ *     target segment must not overlap either of the source segments and
+ *     must have room for the sum of both counts.  With this overload, the 
+ *     Order objective is specified as a template argument.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Order
+ *     Reference to an assortive function which returns true if the first 
+ *     argument belongs first in the sortation order.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[out] target
+ *     Pointer to the first element of the target segment.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Referential<Assortive<Elemental>> Order>
+static inline void
+MergeSegments(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    MergeSegments(base, base_count, relative, relative_count, target, Order);
+}
+
+/**
+ * @brief
+ *     Sorts a contiguous memory segment.
+ * @details
+ *     Performs a stable bottom up merge sort of the segment, where short 
+ *     runs are first sorted by insertion.  The scratch segment must have 
+ *     room for count elements and must not overlap the segment being 
+ *     sorted.  The sorted elements are always left in the segment being 
+ *     sorted.  With this overload, the order objective is specified as a 
+ *     function argument.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @param[in,out] segment
+ *     Pointer to the first element of the segment to be sorted.
+ * @param[in] scratch
+ *     Pointer to the first element of a temporary segment used to merge 
+ *     the sorted runs.
+ * @param[in] count
+ *     Number of elements in the segment.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first 
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+static inline void
+SortSegment(
+    const Locational<Elemental>
+        segment,
+    const Locational<Elemental>
+        scratch,
+    Natural
+        count,
+    Referential<Assortive<Elemental>>
+        order)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    static constexpr Natural Run = 16;
+    Locational<Elemental> from, to, swap;
+    Natural start, index, width, remaining, span;
+    if (count < 2)
+        return;
+    for (start = 0; start < count; start += span) {
+        remaining = count - start;
+        span = remaining < Run ? remaining : Run;
+        for (index = start + 1; index < start + span; index++) {
+            Elemental value = segment[index];
+            Natural vacancy = index;
+            while (vacancy > start && order(value, segment[vacancy - 1])) {
+                segment[vacancy] = segment[vacancy - 1];
+                vacancy--;
+            }
+            segment[vacancy] = value;
+        }
+    }
+    from = segment;
+    to = scratch;
+    for (width = Run; width < count; width += width) {
+        for (start = 0; start < count; start += width + span) {
+            remaining = count - start;
+            if (remaining <= width) {
+                for (index = start; index < count; index++)
+                    to[index] = from[index];
+                break;
+            }
+            span = remaining - width < width ? remaining - width : width;
+            MergeSegments(from + start, width, from + start + width, span, to + start, order);
+        }
+        swap = from;
+        from = to;
+        to = swap;
+        if (count - width <= width)
+            break;
+    }
+    if (from != segment)
+        for (index = 0; index < count; index++)
+            segment[index] = from[index];
+}
+
+/**
+ * @brief
+ *     Sorts a contiguous memory segment.
+ * @details
+ *     Performs a stable bottom up merge sort of the segment, where short 
+ *     runs are first sorted by insertion.  The scratch segment must have 
+ *     room for count elements and must not overlap the segment being 
+ *     sorted.  The sorted elements are always left in the segment being 
+ *     sorted.  With this overload, the Order objective is specified as a 
+ *     template argument.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Order
+ *     Reference to an assortive function which returns true if the first 
+ *     argument belongs first in the sortation order.
+ * @param[in,out] segment
+ *     Pointer to the first element of the segment to be sorted.
+ * @param[in] scratch
+ *     Pointer to the first element of a temporary segment used to merge 
+ *     the sorted runs.
+ * @param[in] count
+ *     Number of elements in the segment.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Referential<Assortive<Elemental>> Order>
+static inline void
+SortSegment(
+    const Locational<Elemental>
+        segment,
+    const Locational<Elemental>
+        scratch,
+    Natural
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    SortSegment(segment, scratch, count, Order);
+}
+
+/**
+ * @brief
+ *     Begins a tournament of loser tree merge competitors.
+ * @details
+ *     Plays the initial matches between the specified number of ways, or 
+ *     merge competitors, identified by the indices 0 to ways - 1.  The tree
+ *     must have room for ways indices.  Each of the elements at index 1 and 
+ *     above receives the loser of one match, while the element at index 0 
+ *     receives the overall winner.  The contest function object is invoked
+ *     with two competitor indices and must return true if the first 
+ *     competitor beats the second, such as when its current element belongs
+ *     first in the sortation order, or when the second competitor is 
+ *     exhausted.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Contestive
+ *     Type of the contest function object.
+ * @param[out] tree
+ *     Pointer to the first element of the loser tree.
+ * @param[in] ways
+ *     Number of merge competitors, which must be at least one.
+ * @param[in] beats
+ *     Reference to the contest function object.
+ * @return
+ *     Index of the winning competitor.
+ */
+template <
+    typename Natural,
+    typename Contestive>
+static inline Natural
+BeginTournament(
+    const Locational<Natural>
+        tree,
+    Natural
+        ways,
+    Referential<const Contestive>
+        beats)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural way, node, winner, loser;
+    for (node = 1; node < ways; node++)
+        tree[node] = ways;
+    tree[0] = 0;
+    for (way = ways; way-- > 0;) {
+        winner = way;
+        for (node = (way + ways) / 2; node > 0; node /= 2) {
+            if (tree[node] == ways) {
+                tree[node] = winner;
+                break;
+            }
+            if (beats(tree[node], winner)) {
+                loser = winner;
+                winner = tree[node];
+                tree[node] = loser;
+            }
+        }
+        if (node == 0)
+            tree[0] = winner;
+    }
+    return tree[0];
+}
+
+/**
+ * @brief
+ *     Replays the matches of the winner of a loser tree tournament.
+ * @details
+ *     After the current element of the winning competitor at index 0 of the
+ *     tree has been consumed and the competitor has advanced, its matches 
+ *     against the losers on its path to the root are replayed, which takes 
+ *     a logarithmic number of contests.  The contest function object must 
+ *     behave as described for BeginTournament.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Contestive
+ *     Type of the contest function object.
+ * @param[in,out] tree
+ *     Pointer to the first element of the loser tree.
+ * @param[in] ways
+ *     Number of merge competitors, which must be at least one.
+ * @param[in] beats
+ *     Reference to the contest function object.
+ * @return
+ *     Index of the new winning competitor.
+ */
+template <
+    typename Natural,
+    typename Contestive>
+static inline Natural
+ReplayTournament(
+    const Locational<Natural>
+        tree,
+    Natural
+        ways,
+    Referential<const Contestive>
+        beats)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural node, winner, loser;
+    winner = tree[0];
+    for (node = (winner + ways) / 2; node > 0; node /= 2) {
+        if (beats(tree[node], winner)) {
+            loser = winner;
+            winner = tree[node];
+            tree[node] = loser;
+        }
+    }
+    return tree[0] = winner;
+}
+
 }
 
 #endif
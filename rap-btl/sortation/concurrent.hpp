@@ -0,0 +1,889 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef CONCURRENT_SORTATION_MODULE
+#define CONCURRENT_SORTATION_MODULE
+#include <sortation.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <system_error>
+#include <thread>
+#else
+extern "C" {
+#include <pthread.h>
+}
+#endif
+
+namespace sortation {
+
+/**
+ * @brief
+ *     Concurrent task range conformity.
+ * @details
+ *     Type definition which is used to hand a range of task indices to a
+ *     POSIX thread when the C++ standard library is not available.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Procedural
+ *     Type of the task function object.
+ */
+template <
+    typename Natural,
+    typename Procedural>
+struct Concurrent {
+
+    Locational<const Procedural>
+        task; /**< Pointer to the task function object. */
+
+    Natural
+        first, /**< First task index in the range. */
+        last; /**< Task index following the last index in the range. */
+};
+
+/**
+ * @brief
+ *     Apportions a count into equal parts.
+ * @details
+ *     Returns the offset of the beginning of the specified part when count
+ *     is divided into the specified number of nearly equal parts.  The
+ *     offset of part parts is count.  The calculation does not overflow
+ *     for any count as long as the square of parts is representable.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @param[in] count
+ *     The count being apportioned.
+ * @param[in] parts
+ *     The number of parts.
+ * @param[in] part
+ *     The part whose offset is returned.
+ * @return
+ *     The offset of the beginning of the part.
+ */
+template <typename Natural>
+static inline Natural
+Apportion(
+    Natural
+        count,
+    Natural
+        parts,
+    Natural
+        part)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    return count / parts * part + count % parts * part / parts;
+}
+
+/**
+ * @brief
+ *     Invokes a task once for each index in a range, concurrently.
+ * @details
+ *     The range is recursively halved, where the upper half is handed to a
+ *     new thread and the lower half is processed by the calling thread,
+ *     until each thread holds one index.  All of the threads are joined
+ *     before this function returns.  If a thread can not be created, the
+ *     indices which it would have processed are processed by the calling
+ *     thread instead.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Procedural
+ *     Type of the task function object, which must be invocable with a
+ *     single natural integer index argument.
+ * @param[in] task
+ *     Reference to the task function object.
+ * @param[in] first
+ *     First task index.
+ * @param[in] last
+ *     Task index following the last task index.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Procedural>
+static inline void
+Concur(
+    Referential<const Procedural>
+        task,
+    Natural
+        first,
+    Natural
+        last);
+
+template <
+    typename Natural,
+    typename Procedural>
+static inline Locational<void>
+ConcurThread(
+    const Locational<void>
+        locality)
+{
+    using Specific = Locational<const Concurrent<Natural, Procedural>>;
+    const Specific range = static_cast<Specific>(locality);
+    Concur(*range->task, range->first, range->last);
+    return 0;
+}
+
+template <
+    typename Natural,
+    typename Procedural>
+static inline void
+Concur(
+    Referential<const Procedural>
+        task,
+    Natural
+        first,
+    Natural
+        last)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (last <= first)
+        return;
+    if (last - first == 1) {
+        task(first);
+        return;
+    }
+    const Natural middle = first + (last - first) / 2;
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    thread helper;
+    try {
+        helper = thread([&task, middle, last] { Concur(task, middle, last); });
+    } catch (Referential<const system_error>) {
+        Concur(task, middle, last);
+    }
+    Concur(task, first, middle);
+    if (helper.joinable())
+        helper.join();
+#else
+    const Concurrent<Natural, Procedural> range = { &task, middle, last };
+    pthread_t helper;
+    const bool spawned = !pthread_create(&helper, 0, ConcurThread<Natural, Procedural>, const_cast<Locational<Concurrent<Natural, Procedural>>>(&range));
+    if (!spawned)
+        Concur(task, middle, last);
+    Concur(task, first, middle);
+    if (spawned)
+        pthread_join(helper, 0);
+#endif
+}
+
+/**
+ * @brief
+ *     Partitions a stable merge of two sorted segments.
+ * @details
+ *     Returns the number of base segment elements which are among the
+ *     first rank elements of the stable merge of the base and relative
+ *     segments, as produced by MergeSegments.  The remaining rank elements
+ *     come from the relative segment.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[in] rank
+ *     Number of merged elements, which must not exceed the sum of both
+ *     counts.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Number of base segment elements within rank.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+static inline Natural
+PartitionMerge(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    Natural
+        rank,
+    Referential<Assortive<Elemental>>
+        order)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural low, high, middle, opposite;
+    low = rank > relative_count ? rank - relative_count : 0;
+    high = rank < base_count ? rank : base_count;
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        opposite = rank - middle;
+        if (opposite > 0 && !order(relative[opposite - 1], base[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief
+ *     Locates the lower bound of a value in a sorted segment.
+ * @details
+ *     Returns the offset of the first element in the segment which does
+ *     not belong before the value in the sortation order, or count if
+ *     there is no such element.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @param[in] segment
+ *     Pointer to the first element of the sorted segment.
+ * @param[in] count
+ *     Number of elements in the segment.
+ * @param[in] value
+ *     Reference to the value being bounded.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Offset of the lower bound.
+ */
+template <
+    typename Natural,
+    typename Elemental>
+static inline Natural
+DelimitSegment(
+    const Locational<const Elemental>
+        segment,
+    Natural
+        count,
+    Referential<const Elemental>
+        value,
+    Referential<Assortive<Elemental>>
+        order)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    Natural low, high, middle;
+    low = 0;
+    high = count;
+    while (low < high) {
+        middle = low + (high - low) / 2;
+        if (order(segment[middle], value))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief
+ *     Sorts a contiguous memory segment using multiple threads.
+ * @details
+ *     The segment is divided into a power of two number of parts which are
+ *     sorted concurrently using SortSegment.  The sorted parts are then
+ *     merged pairwise in rounds, where each round is divided evenly
+ *     between all of the threads by partitioning each merge at the
+ *     boundaries of the output which each thread is responsible for.
+ *     Segments which are too small to benefit from multiple threads are
+ *     sorted by the calling thread alone.  The scratch segment must have
+ *     room for count elements and must not overlap the segment being
+ *     sorted.  With this overload, the order objective is specified as a
+ *     function argument.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Threads
+ *     Maximum number of threads to use, including the calling thread.
+ * @param[in,out] segment
+ *     Pointer to the first element of the segment to be sorted.
+ * @param[in] scratch
+ *     Pointer to the first element of a temporary segment.
+ * @param[in] count
+ *     Number of elements in the segment.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads>
+static inline void
+SortSegmentConcurrently(
+    const Locational<Elemental>
+        segment,
+    const Locational<Elemental>
+        scratch,
+    Natural
+        count,
+    Referential<Assortive<Elemental>>
+        order)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        Threads > 0,
+        "Threads:  At least one thread required");
+#endif
+    static constexpr Natural Granularity = 0x2000;
+    Locational<Elemental> from, to, swap;
+    Natural pieces, width;
+    pieces = 1;
+    while (pieces <= Threads / 2 && count / (pieces * 2) >= Granularity)
+        pieces *= 2;
+    if (pieces < 2) {
+        SortSegment(segment, scratch, count, order);
+        return;
+    }
+    auto sort_piece = [&](Natural piece) {
+        const Natural first = Apportion(count, pieces, piece);
+        SortSegment(segment + first, scratch + first, Apportion(count, pieces, piece + 1) - first, order);
+    };
+    Concur(sort_piece, Natural(0), pieces);
+    from = segment;
+    to = scratch;
+    for (width = 1; width < pieces; width *= 2) {
+        auto merge_slice = [&](Natural slice) {
+            const Natural low = Apportion(count, Threads, slice);
+            const Natural high = Apportion(count, Threads, slice + 1);
+            Natural pair, first, middle, last, begin, end, base_begin, base_end;
+            for (pair = 0; pair < pieces; pair += width * 2) {
+                first = Apportion(count, pieces, pair);
+                middle = Apportion(count, pieces, pair + width);
+                last = Apportion(count, pieces, pair + width * 2);
+                if (last <= low)
+                    continue;
+                if (first >= high)
+                    break;
+                begin = (low > first ? low : first) - first;
+                end = (high < last ? high : last) - first;
+                base_begin = PartitionMerge<Natural, Elemental>(from + first, middle - first, from + middle, last - middle, begin, order);
+                base_end = PartitionMerge<Natural, Elemental>(from + first, middle - first, from + middle, last - middle, end, order);
+                MergeSegments<Natural, Elemental>(
+                    from + first + base_begin,
+                    base_end - base_begin,
+                    from + middle + begin - base_begin,
+                    end - base_end - begin + base_begin,
+                    to + first + begin,
+                    order);
+            }
+        };
+        Concur(merge_slice, Natural(0), Threads);
+        swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from != segment) {
+        auto copy_slice = [&](Natural slice) {
+            const Natural high = Apportion(count, Threads, slice + 1);
+            for (Natural index = Apportion(count, Threads, slice); index < high; index++)
+                segment[index] = from[index];
+        };
+        Concur(copy_slice, Natural(0), Threads);
+    }
+}
+
+/**
+ * @brief
+ *     Sorts a contiguous memory segment using multiple threads.
+ * @details
+ *     The segment is divided into a power of two number of parts which are
+ *     sorted concurrently using SortSegment.  The sorted parts are then
+ *     merged pairwise in rounds, where each round is divided evenly
+ *     between all of the threads by partitioning each merge at the
+ *     boundaries of the output which each thread is responsible for.
+ *     Segments which are too small to benefit from multiple threads are
+ *     sorted by the calling thread alone.  The scratch segment must have
+ *     room for count elements and must not overlap the segment being
+ *     sorted.  With this overload, the Order objective is specified as a
+ *     template argument.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Threads
+ *     Maximum number of threads to use, including the calling thread.
+ * @tparam Order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @param[in,out] segment
+ *     Pointer to the first element of the segment to be sorted.
+ * @param[in] scratch
+ *     Pointer to the first element of a temporary segment.
+ * @param[in] count
+ *     Number of elements in the segment.
+ * @return
+ *     Does not return any value.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads,
+    Referential<Assortive<Elemental>> Order>
+static inline void
+SortSegmentConcurrently(
+    const Locational<Elemental>
+        segment,
+    const Locational<Elemental>
+        scratch,
+    Natural
+        count)
+{
+    SortSegmentConcurrently<Natural, Elemental, Threads>(segment, scratch, count, Order);
+}
+
+/**
+ * @brief
+ *     Composes the union or intersection of one part of two sorted
+ *     segments.
+ * @details
+ *     Used by UniteSegmentsConcurrently and IntersectSegmentsConcurrently.
+ *     When the target is null, the elements are only counted.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Unite
+ *     True for union or false for intersection.
+ * @param[in] base
+ *     Pointer to the first element of the base part.
+ * @param[in] base_count
+ *     Number of elements in the base part.
+ * @param[in] relative
+ *     Pointer to the first element of the relative part.
+ * @param[in] relative_count
+ *     Number of elements in the relative part.
+ * @param[out] target
+ *     Pointer to the first element of the target segment or null.
+ * @param[in] equate
+ *     Reference to an assortive function which returns true if both
+ *     arguments are to be considered equal.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Number of elements composed.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    const bool Unite>
+static inline Natural
+ComposeSegmentPart(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target,
+    Referential<Assortive<Elemental>>
+        equate,
+    Referential<Assortive<Elemental>>
+        order)
+{
+    Natural base_index, relative_index, target_index;
+    base_index = relative_index = target_index = 0;
+    while (base_index < base_count && relative_index < relative_count) {
+        if (equate(base[base_index], relative[relative_index])) {
+            if (target)
+                target[target_index] = base[base_index];
+            target_index++;
+            base_index++;
+            relative_index++;
+        } else if (order(base[base_index], relative[relative_index])) {
+            if (Unite && target)
+                target[target_index] = base[base_index];
+            if (Unite)
+                target_index++;
+            base_index++;
+        } else {
+            if (Unite && target)
+                target[target_index] = relative[relative_index];
+            if (Unite)
+                target_index++;
+            relative_index++;
+        }
+    }
+    if (!Unite)
+        return target_index;
+    if (target) {
+        while (base_index < base_count)
+            target[target_index++] = base[base_index++];
+        while (relative_index < relative_count)
+            target[target_index++] = relative[relative_index++];
+        return target_index;
+    }
+    return target_index + base_count - base_index + relative_count - relative_index;
+}
+
+/**
+ * @brief
+ *     Composes the union or intersection of two sorted segments using
+ *     multiple threads.
+ * @details
+ *     Used by UniteSegmentsConcurrently and IntersectSegmentsConcurrently.
+ *     Split points are chosen evenly in the larger segment and located in
+ *     the smaller segment by bisection, so that equal elements always
+ *     fall within the same part.  The parts are first counted concurrently
+ *     and then composed concurrently at their final offsets.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads,
+    const bool Unite>
+static inline Natural
+ComposeSegmentsConcurrently(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target,
+    Referential<Assortive<Elemental>>
+        equate,
+    Referential<Assortive<Elemental>>
+        order)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        Threads > 0,
+        "Threads:  At least one thread required");
+#endif
+    static auto& ComposePart = ComposeSegmentPart<Natural, Elemental, Unite>;
+    static constexpr Natural Granularity = 0x2000;
+    const bool based = base_count >= relative_count;
+    const Natural larger = based ? base_count : relative_count;
+    Natural offsets[Threads + 1];
+    Natural pieces, piece;
+    pieces = larger / Granularity;
+    if (pieces > Threads)
+        pieces = Threads;
+    if (pieces < 2)
+        return ComposePart(base, base_count, relative, relative_count, target, equate, order);
+    auto split = [&](Natural piece, Referential<Natural> base_split, Referential<Natural> relative_split) {
+        if (piece == 0) {
+            base_split = 0;
+            relative_split = 0;
+        } else if (piece == pieces) {
+            base_split = base_count;
+            relative_split = relative_count;
+        } else if (based) {
+            base_split = Apportion(base_count, pieces, piece);
+            relative_split = DelimitSegment(relative, relative_count, base[base_split], order);
+        } else {
+            relative_split = Apportion(relative_count, pieces, piece);
+            base_split = DelimitSegment(base, base_count, relative[relative_split], order);
+        }
+    };
+    auto compose_piece = [&](Natural piece, Locational<Elemental> destination) {
+        Natural base_first, base_last, relative_first, relative_last;
+        split(piece, base_first, relative_first);
+        split(piece + 1, base_last, relative_last);
+        return ComposePart(
+            base + base_first,
+            base_last - base_first,
+            relative + relative_first,
+            relative_last - relative_first,
+            destination,
+            equate,
+            order);
+    };
+    auto count_piece = [&](Natural piece) {
+        offsets[piece + 1] = compose_piece(piece, 0);
+    };
+    Concur(count_piece, Natural(0), pieces);
+    offsets[0] = 0;
+    for (piece = 1; piece <= pieces; piece++)
+        offsets[piece] += offsets[piece - 1];
+    auto write_piece = [&](Natural piece) {
+        compose_piece(piece, target + offsets[piece]);
+    };
+    Concur(write_piece, Natural(0), pieces);
+    return offsets[pieces];
+}
+
+/**
+ * @brief
+ *     Composes the union of two sorted segments using multiple threads.
+ * @details
+ *     Both segments must be sorted in the same sortation order and must
+ *     not contain duplicate elements.  Elements present in both segments
+ *     are copied from the base segment once.  The target segment must not
+ *     overlap either source segment and must have room for the sum of
+ *     both counts.  Inputs which are too small to benefit from multiple
+ *     threads are composed by the calling thread alone.  With this
+ *     overload, the equate and order objectives are specified as function
+ *     arguments.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Threads
+ *     Maximum number of threads to use, including the calling thread.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[out] target
+ *     Pointer to the first element of the target segment.
+ * @param[in] equate
+ *     Reference to an assortive function which returns true if both
+ *     arguments are to be considered equal.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Number of elements in the union.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads>
+static inline Natural
+UniteSegmentsConcurrently(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target,
+    Referential<Assortive<Elemental>>
+        equate,
+    Referential<Assortive<Elemental>>
+        order)
+{
+    return ComposeSegmentsConcurrently<Natural, Elemental, Threads, true>(base, base_count, relative, relative_count, target, equate, order);
+}
+
+/**
+ * @brief
+ *     Composes the union of two sorted segments using multiple threads.
+ * @details
+ *     Both segments must be sorted in the same sortation order and must
+ *     not contain duplicate elements.  Elements present in both segments
+ *     are copied from the base segment once.  The target segment must not
+ *     overlap either source segment and must have room for the sum of
+ *     both counts.  Inputs which are too small to benefit from multiple
+ *     threads are composed by the calling thread alone.  With this
+ *     overload, the Equate and Order objectives are specified as template
+ *     arguments.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Threads
+ *     Maximum number of threads to use, including the calling thread.
+ * @tparam Equate
+ *     Reference to an assortive function which returns true if both
+ *     arguments are to be considered equal.
+ * @tparam Order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[out] target
+ *     Pointer to the first element of the target segment.
+ * @return
+ *     Number of elements in the union.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order>
+static inline Natural
+UniteSegmentsConcurrently(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target)
+{
+    return ComposeSegmentsConcurrently<Natural, Elemental, Threads, true>(base, base_count, relative, relative_count, target, Equate, Order);
+}
+
+/**
+ * @brief
+ *     Composes the intersection of two sorted segments using multiple
+ *     threads.
+ * @details
+ *     Both segments must be sorted in the same sortation order and must
+ *     not contain duplicate elements.  Elements present in both segments
+ *     are copied from the base segment.  The target segment must not
+ *     overlap either source segment and must have room for the smaller of
+ *     both counts.  Inputs which are too small to benefit from multiple
+ *     threads are composed by the calling thread alone.  With this
+ *     overload, the equate and order objectives are specified as function
+ *     arguments.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Threads
+ *     Maximum number of threads to use, including the calling thread.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[out] target
+ *     Pointer to the first element of the target segment.
+ * @param[in] equate
+ *     Reference to an assortive function which returns true if both
+ *     arguments are to be considered equal.
+ * @param[in] order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @return
+ *     Number of elements in the intersection.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads>
+static inline Natural
+IntersectSegmentsConcurrently(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target,
+    Referential<Assortive<Elemental>>
+        equate,
+    Referential<Assortive<Elemental>>
+        order)
+{
+    return ComposeSegmentsConcurrently<Natural, Elemental, Threads, false>(base, base_count, relative, relative_count, target, equate, order);
+}
+
+/**
+ * @brief
+ *     Composes the intersection of two sorted segments using multiple
+ *     threads.
+ * @details
+ *     Both segments must be sorted in the same sortation order and must
+ *     not contain duplicate elements.  Elements present in both segments
+ *     are copied from the base segment.  The target segment must not
+ *     overlap either source segment and must have room for the smaller of
+ *     both counts.  Inputs which are too small to benefit from multiple
+ *     threads are composed by the calling thread alone.  With this
+ *     overload, the Equate and Order objectives are specified as template
+ *     arguments.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Threads
+ *     Maximum number of threads to use, including the calling thread.
+ * @tparam Equate
+ *     Reference to an assortive function which returns true if both
+ *     arguments are to be considered equal.
+ * @tparam Order
+ *     Reference to an assortive function which returns true if the first
+ *     argument belongs first in the sortation order.
+ * @param[in] base
+ *     Pointer to the first element of the base segment.
+ * @param[in] base_count
+ *     Number of elements in the base segment.
+ * @param[in] relative
+ *     Pointer to the first element of the relative segment.
+ * @param[in] relative_count
+ *     Number of elements in the relative segment.
+ * @param[out] target
+ *     Pointer to the first element of the target segment.
+ * @return
+ *     Number of elements in the intersection.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    Natural Threads,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order>
+static inline Natural
+IntersectSegmentsConcurrently(
+    const Locational<const Elemental>
+        base,
+    Natural
+        base_count,
+    const Locational<const Elemental>
+        relative,
+    Natural
+        relative_count,
+    const Locational<Elemental>
+        target)
+{
+    return ComposeSegmentsConcurrently<Natural, Elemental, Threads, false>(base, base_count, relative, relative_count, target, Equate, Order);
+}
+
+}
+
+#endif
@@ -0,0 +1,573 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef SORTATION_EXTERNAL_MODULE
+#define SORTATION_EXTERNAL_MODULE
+#include <sortation.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstdio>
+#else
+extern "C" {
+#include <stdio.h>
+}
+#endif
+
+namespace sortation {
+
+/**
+ * @brief
+ *     External memory sortation using the C or C++ standard library file
+ *     functions.
+ * @details
+ *     Sorted runs of elements which do not fit within a fixed capacity
+ *     memory space, such as a ration resource, are spilled to temporary
+ *     files and later merged using a loser tree with buffered reads.  Runs
+ *     are merged in levels, like the digits of a counter, so that whenever
+ *     the maximum number of runs of one level has been spilled, they are
+ *     merged into a single run of the next level.  Each element is thereby
+ *     written once per level, and any number of elements can be sorted
+ *     within a fixed amount of memory.  Elements are written to and
+ *     read from the temporary files as raw bytes and must therefore be of a
+ *     trivially copyable type.
+ */
+namespace external {
+
+    /**
+     * @brief
+     *     Number of merge levels.
+     * @details
+     *     Each level holds fewer than the maximum number of runs which are
+     *     merged at once, so that with Ways runs merged at once, Ways to the
+     *     power of Depth runs can be spilled before runs of unequal levels
+     *     are merged together.
+     */
+    constexpr size_t Depth = 16;
+
+    /**
+     * @brief
+     *     Buffered temporary file run conformity.
+     * @details
+     *     Type definition which holds a temporary file containing one sorted
+     *     run of elements along with the buffer from which the run is read.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Buffer
+     *     Number of elements which each read transfers.
+     */
+    template <
+        typename Natural,
+        typename Elemental,
+        Natural Buffer>
+    struct Streaming {
+
+        Locational<FILE>
+            handle; /**< Temporary file containing the run. */
+
+        Natural
+            position, /**< Position of the current element in the buffer. */
+            count; /**< Number of elements held in the buffer. */
+
+        Elemental
+            buffer[Buffer]; /**< Elements read from the temporary file. */
+    };
+
+    /**
+     * @brief
+     *     External memory sortation conformity.
+     * @details
+     *     Type definition which holds the temporary files and merge levels
+     *     of all of the runs which have been spilled, in the order in which
+     *     they were spilled, along with the buffers used to read the runs
+     *     being merged and to write merged runs.  Because of its size, an
+     *     instance is best given static storage duration.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read or write transfers.
+     */
+    template <
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer>
+    struct Externalized {
+
+        Streaming<Natural, Elemental, Buffer>
+            runs[Ways]; /**< Runs which are being merged. */
+
+        Locational<FILE>
+            handles[(Ways - 1) * Depth + 1]; /**< Temporary files of the runs
+                                              *   which have been spilled.
+                                              */
+
+        Natural
+            levels[(Ways - 1) * Depth + 1]; /**< Merge level of each run. */
+
+        Elemental
+            spill[Buffer]; /**< Elements waiting to be written. */
+
+        Natural
+            count; /**< Number of runs which have been spilled. */
+    };
+
+    /**
+     * @brief
+     *     Initializes an external memory sortation.
+     * @details
+     *     Sets the number of spilled runs to zero.  Must be invoked before
+     *     any other function receives the sortation.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read or write transfers.
+     * @param[out] external
+     *     Reference to the external memory sortation.
+     * @return
+     *     Does not return any value.
+     */
+    template <
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer>
+    static inline void
+    Initialize(Referential<Externalized<Natural, Elemental, Ways, Buffer>> external)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+        static_assert(
+            Ways > 1 && Buffer > 0,
+            "Ways, Buffer:  At least two ways and one element required");
+#endif
+        external.count = 0;
+    }
+
+    /**
+     * @brief
+     *     Discards all of the runs of an external memory sortation.
+     * @details
+     *     Closes the temporary files of all spilled runs, which removes
+     *     them, and sets the number of spilled runs to zero.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read or write transfers.
+     * @param[in,out] external
+     *     Reference to the external memory sortation.
+     * @return
+     *     Does not return any value.
+     */
+    template <
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer>
+    static inline void
+    Discard(Referential<Externalized<Natural, Elemental, Ways, Buffer>> external)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+#endif
+        while (external.count > 0)
+            fclose(external.handles[--external.count]);
+    }
+
+    /**
+     * @brief
+     *     Reads the next elements of a run into its buffer.
+     * @details
+     *     The run is exhausted when no elements could be read.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Buffer
+     *     Number of elements which each read transfers.
+     * @param[in,out] run
+     *     Reference to the run.
+     * @return
+     *     Whether the read succeeded without a file error.
+     */
+    template <
+        typename Natural,
+        typename Elemental,
+        Natural Buffer>
+    static inline bool
+    Fill(Referential<Streaming<Natural, Elemental, Buffer>> run)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+#endif
+        run.position = 0;
+        run.count = fread(run.buffer, sizeof(Elemental), Buffer, run.handle);
+        return !ferror(run.handle);
+    }
+
+    /**
+     * @brief
+     *     Merges the last runs of an external memory sortation.
+     * @details
+     *     Used by Coalesce and Merge.  The runs from the specified run
+     *     onwards, of which there must be no more than Ways, are merged
+     *     as described for Merge and are discarded after the merge, whether
+     *     it succeeds or not.
+     * @tparam Unique
+     *     Whether equal elements are presented only once.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read transfers.
+     * @tparam Receptive
+     *     Type of the sink function object, which must be invocable with a
+     *     constant element reference and return bool.
+     * @param[in,out] external
+     *     Reference to the external memory sortation.
+     * @param[in] from
+     *     Index of the first run to be merged.
+     * @param[in] sink
+     *     Reference to the sink function object.
+     * @param[in] equate
+     *     Reference to an assortive function which returns true if both
+     *     arguments are to be considered equal.
+     * @param[in] order
+     *     Reference to an assortive function which returns true if the first
+     *     argument belongs first in the sortation order.
+     * @return
+     *     Whether every element was read and accepted by the sink.
+     */
+    template <
+        const bool Unique,
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer,
+        typename Receptive>
+    static inline bool
+    Combine(
+        Referential<Externalized<Natural, Elemental, Ways, Buffer>>
+            external,
+        const Natural
+            from,
+        Referential<const Receptive>
+            sink,
+        Referential<Assortive<Elemental>>
+            equate,
+        Referential<Assortive<Elemental>>
+            order)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        using Run = Streaming<Natural, Elemental, Buffer>;
+        const Natural ways = external.count - from;
+        Natural tree[Ways];
+        Natural index, way;
+        Elemental last;
+        bool held, complete;
+        auto discard = [&external, from]() {
+            while (external.count > from)
+                fclose(external.handles[--external.count]);
+        };
+        if (ways == 0)
+            return true;
+        for (index = 0; index < ways; index++) {
+            external.runs[index].handle = external.handles[from + index];
+            rewind(external.runs[index].handle);
+            if (!Fill(external.runs[index])) {
+                discard();
+                return false;
+            }
+        }
+        auto beats = [&external, &order](Natural first, Natural second) -> bool {
+            Referential<const Run> former = external.runs[first];
+            Referential<const Run> latter = external.runs[second];
+            if (former.position == former.count)
+                return false;
+            if (latter.position == latter.count)
+                return true;
+            if (order(former.buffer[former.position], latter.buffer[latter.position]))
+                return true;
+            if (order(latter.buffer[latter.position], former.buffer[former.position]))
+                return false;
+            return first < second;
+        };
+        held = false;
+        complete = true;
+        way = BeginTournament(tree, ways, beats);
+        while (external.runs[way].position < external.runs[way].count) {
+            Referential<Run> run = external.runs[way];
+            Referential<const Elemental> value = run.buffer[run.position];
+            if (!Unique || !held || !equate(last, value)) {
+                if (!sink(value)) {
+                    complete = false;
+                    break;
+                }
+                if (Unique) {
+                    last = value;
+                    held = true;
+                }
+            }
+            if (++run.position == run.count && !Fill(run)) {
+                complete = false;
+                break;
+            }
+            way = ReplayTournament(tree, ways, beats);
+        }
+        discard();
+        return complete;
+    }
+
+    /**
+     * @brief
+     *     Merges the last runs of an external memory sortation into a
+     *     single run of the next level.
+     * @details
+     *     Used by Spill and Merge.  The runs from the specified run
+     *     onwards, of which there must be no more than Ways, are replaced
+     *     by one run which is one level above the first of them.  All of
+     *     the runs are discarded if the merge fails.
+     * @tparam Unique
+     *     Whether equal elements are kept only once.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read or write transfers.
+     * @param[in,out] external
+     *     Reference to the external memory sortation.
+     * @param[in] from
+     *     Index of the first run to be merged.
+     * @param[in] equate
+     *     Reference to an assortive function which returns true if both
+     *     arguments are to be considered equal.
+     * @param[in] order
+     *     Reference to an assortive function which returns true if the first
+     *     argument belongs first in the sortation order.
+     * @return
+     *     Whether the runs were merged without a file error.
+     */
+    template <
+        const bool Unique,
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer>
+    static inline bool
+    Coalesce(
+        Referential<Externalized<Natural, Elemental, Ways, Buffer>>
+            external,
+        const Natural
+            from,
+        Referential<Assortive<Elemental>>
+            equate,
+        Referential<Assortive<Elemental>>
+            order)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural level = external.levels[from] + 1;
+        const Locational<FILE> handle = tmpfile();
+        Natural filled;
+        if (!handle) {
+            Discard(external);
+            return false;
+        }
+        filled = 0;
+        auto write = [&external, &handle, &filled](Referential<const Elemental> value) -> bool {
+            external.spill[filled++] = value;
+            if (filled < Buffer)
+                return true;
+            filled = 0;
+            return fwrite(external.spill, sizeof(Elemental), Buffer, handle) == Buffer;
+        };
+        if (!Combine<Unique>(external, from, write, equate, order) || fwrite(external.spill, sizeof(Elemental), filled, handle) != filled) {
+            fclose(handle);
+            Discard(external);
+            return false;
+        }
+        external.handles[external.count] = handle;
+        external.levels[external.count++] = level;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Merges all of the runs of an external memory sortation.
+     * @details
+     *     The sink function object is invoked once for each merged element
+     *     in sortation order and must return false to abandon the merge.
+     *     Equal elements from different runs are presented in the order in
+     *     which the runs were spilled.  When Unique is true, only the first
+     *     of each group of equal elements is presented to the sink.  If more
+     *     than Ways runs have been spilled, the last runs are first merged
+     *     into runs of the next level until Ways runs remain.  All of the
+     *     runs are discarded after the merge, whether it succeeds or not.
+     * @tparam Unique
+     *     Whether equal elements are presented only once.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read transfers.
+     * @tparam Receptive
+     *     Type of the sink function object, which must be invocable with a
+     *     constant element reference and return bool.
+     * @param[in,out] external
+     *     Reference to the external memory sortation.
+     * @param[in] sink
+     *     Reference to the sink function object.
+     * @param[in] equate
+     *     Reference to an assortive function which returns true if both
+     *     arguments are to be considered equal.
+     * @param[in] order
+     *     Reference to an assortive function which returns true if the first
+     *     argument belongs first in the sortation order.
+     * @return
+     *     Whether every element was read and accepted by the sink.
+     */
+    template <
+        const bool Unique,
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer,
+        typename Receptive>
+    static inline bool
+    Merge(
+        Referential<Externalized<Natural, Elemental, Ways, Buffer>>
+            external,
+        Referential<const Receptive>
+            sink,
+        Referential<Assortive<Elemental>>
+            equate,
+        Referential<Assortive<Elemental>>
+            order)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        while (external.count > Ways)
+            if (!Coalesce<Unique>(external, external.count - Ways, equate, order))
+                return false;
+        return Combine<Unique>(external, Natural(0), sink, equate, order);
+    }
+
+    /**
+     * @brief
+     *     Spills a sorted run of elements to a temporary file.
+     * @details
+     *     The elements of the segment must already be sorted.  The run is
+     *     spilled at the lowest level, and whenever the last Ways runs are
+     *     of the same level, they are merged into a single run of the next
+     *     level.  Afterwards the segment may be reused to collect more
+     *     elements.
+     * @tparam Unique
+     *     Whether equal elements are kept only once when runs are merged.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Elemental
+     *     Type of the elements.
+     * @tparam Ways
+     *     Maximum number of runs which are merged at once.
+     * @tparam Buffer
+     *     Number of elements which each read or write transfers.
+     * @param[in,out] external
+     *     Reference to the external memory sortation.
+     * @param[in] segment
+     *     Pointer to the first element of the sorted segment.
+     * @param[in] count
+     *     Number of elements in the segment.
+     * @param[in] equate
+     *     Reference to an assortive function which returns true if both
+     *     arguments are to be considered equal.
+     * @param[in] order
+     *     Reference to an assortive function which returns true if the first
+     *     argument belongs first in the sortation order.
+     * @return
+     *     Whether the run was spilled without a file error.
+     */
+    template <
+        const bool Unique,
+        typename Natural,
+        typename Elemental,
+        Natural Ways,
+        Natural Buffer>
+    static inline bool
+    Spill(
+        Referential<Externalized<Natural, Elemental, Ways, Buffer>>
+            external,
+        const Locational<const Elemental>
+            segment,
+        Natural
+            count,
+        Referential<Assortive<Elemental>>
+            equate,
+        Referential<Assortive<Elemental>>
+            order)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        constexpr Natural Capacity = (Ways - 1) * Depth + 1;
+        Locational<FILE> handle;
+        if (count == 0)
+            return true;
+        handle = tmpfile();
+        if (!handle)
+            return false;
+        if (fwrite(segment, sizeof(Elemental), count, handle) != count) {
+            fclose(handle);
+            return false;
+        }
+        external.handles[external.count] = handle;
+        external.levels[external.count++] = 0;
+        while (external.count >= Ways && (external.levels[external.count - Ways] == external.levels[external.count - 1] || external.count == Capacity))
+            if (!Coalesce<Unique>(external, external.count - Ways, equate, order))
+                return false;
+        return true;
+    }
+
+}
+
+}
+
+#endif
@@ -0,0 +1,435 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef SORTATION_INSTRUMENTATION_MODULE
+#define SORTATION_INSTRUMENTATION_MODULE
+#include <instrumentation.hpp>
+#include <sortation.hpp>
+
+namespace sortation {
+
+/**
+ * @brief
+ *     Search cost instrumentation.
+ * @details
+ *     Search functions which record the number of element comparisons made
+ *     and the number of positions traversed by the search functions they
+ *     wrap, in an instrumental conformity of the instrumentation module
+ *     declared at namespace scope, so that the aggregate cost of the
+ *     searches made at any one call site can be quantified.  Comparisons
+ *     are counted as probes by wrapping the assortive functions with the
+ *     instrumentation::Probe function and positions traversed are the sum
+ *     of the offsets given to the traverse functions of the scalar
+ *     trajection objectives, which is what bisection costs when the space
+ *     is not randomly accessible.
+ *     Unless RAPBTL_INSTRUMENTATION is defined, each search function simply
+ *     forwards to the search function it wraps.
+ */
+namespace instrumentation {
+
+    using ::instrumentation::Instrumental;
+    using ::instrumentation::Probe;
+
+    template <
+        typename Natural,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    Conclude(
+        const bool
+            result,
+        const Natural
+            traversals)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        const Natural distance = Record.traversals - traversals;
+        Record.searches++;
+        if (result)
+            Record.successes++;
+        if (distance > Record.farthest)
+            Record.farthest = distance;
+        return result;
+    }
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Scalar<Spatial, Positional, Natural, Endemical>> Scale,
+        Referential<Instrumental<Natural>> Record>
+    static inline Referential<const Positional>
+    Traverse(
+        Referential<Spatial>
+            space,
+        Referential<Positional>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Record.traversals += count;
+        return Scale.traverse(space, position, count);
+    }
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Lineal<Spatial, Positional, Natural, Endemical>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    static inline Referential<const Positional>
+    TraverseIncrement(
+        Referential<Spatial>
+            space,
+        Referential<Positional>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Record.traversals += count;
+        return Liner.increment.traverse(space, position, count);
+    }
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Lineal<Spatial, Positional, Natural, Endemical>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    static inline Referential<const Positional>
+    TraverseDecrement(
+        Referential<Spatial>
+            space,
+        Referential<Positional>
+            position,
+        Referential<const Natural>
+            count)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        Record.traversals += count;
+        return Liner.decrement.traverse(space, position, count);
+    }
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Scalar<Spatial, Positional, Natural, Endemical>> Scale,
+        Referential<Instrumental<Natural>> Record>
+    constexpr Scalar<Spatial, Positional, Natural, Endemical>
+        InstrumentedScale = {
+            Scale.order,
+            Scale.begin,
+            Traverse<Spatial, Positional, Natural, Endemical, Scale, Record>,
+            Scale.go
+        };
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Lineal<Spatial, Positional, Natural, Endemical>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    constexpr Scalar<Spatial, Positional, Natural, Endemical>
+        InstrumentedIncrement = {
+            Liner.increment.order,
+            Liner.increment.begin,
+            TraverseIncrement<Spatial, Positional, Natural, Endemical, Liner, Record>,
+            Liner.increment.go
+        };
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Lineal<Spatial, Positional, Natural, Endemical>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    constexpr Scalar<Spatial, Positional, Natural, Endemical>
+        InstrumentedDecrement = {
+            Liner.decrement.order,
+            Liner.decrement.begin,
+            TraverseDecrement<Spatial, Positional, Natural, Endemical, Liner, Record>,
+            Liner.decrement.go
+        };
+
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Endemical,
+        Referential<const Lineal<Spatial, Positional, Natural, Endemical>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    constexpr Lineal<Spatial, Positional, Natural, Endemical>
+        InstrumentedLiner = {
+            InstrumentedIncrement<Spatial, Positional, Natural, Endemical, Liner, Record>,
+            InstrumentedDecrement<Spatial, Positional, Natural, Endemical, Liner, Record>
+        };
+
+    /**
+     * @brief
+     *     Searches sequentially for some value in a scalar space while
+     *     recording the cost of the search.
+     * @details
+     *     Behaves as the corresponding sortation::SearchSection overload.
+     * @tparam Record
+     *     Reference to the search instrumentation record.
+     */
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Evaluative,
+        Referential<Assortive<Evaluative>> Equate,
+        Referential<const Scalar<const Spatial, Positional, Natural, const Evaluative>> Scale,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    SearchSection(
+        Referential<const Spatial>
+            space,
+        Referential<const Evaluative>
+            value,
+        Referential<Positional>
+            position,
+        Natural
+            extent)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+#ifdef RAPBTL_INSTRUMENTATION
+        constexpr auto& Compared = Probe<Evaluative, Equate, Natural, Record>;
+        const Natural traversals = Record.traversals;
+        return Conclude<Natural, Record>(
+            ::sortation::SearchSection(space, InstrumentedScale<const Spatial, Positional, Natural, const Evaluative, Scale, Record>, value, position, extent, Compared),
+            traversals);
+#else
+        return ::sortation::SearchSection<Spatial, Positional, Natural, Evaluative, Equate, Scale>(space, value, position, extent);
+#endif
+    }
+
+    /**
+     * @brief
+     *     Searches sequentially for some value in a scalar space while
+     *     recording the cost of the search.
+     * @details
+     *     Behaves as the corresponding sortation::SearchSectionIteratively
+     *     overload.
+     * @tparam Record
+     *     Reference to the search instrumentation record.
+     */
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Evaluative,
+        Referential<Assortive<Evaluative>> Equate,
+        Referential<const Scalar<const Spatial, Positional, Natural, const Evaluative>> Scale,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    SearchSectionIteratively(
+        Referential<const Spatial>
+            space,
+        Referential<const Evaluative>
+            value,
+        Referential<Positional>
+            position,
+        Referential<Natural>
+            extent)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+#ifdef RAPBTL_INSTRUMENTATION
+        constexpr auto& Compared = Probe<Evaluative, Equate, Natural, Record>;
+        const Natural traversals = Record.traversals;
+        return Conclude<Natural, Record>(
+            ::sortation::SearchSectionIteratively(space, InstrumentedScale<const Spatial, Positional, Natural, const Evaluative, Scale, Record>, value, position, extent, Compared),
+            traversals);
+#else
+        return ::sortation::SearchSectionIteratively<Spatial, Positional, Natural, Evaluative, Equate, Scale>(space, value, position, extent);
+#endif
+    }
+
+    /**
+     * @brief
+     *     Searches bisectionally for some value in a linear space while
+     *     recording the cost of the search.
+     * @details
+     *     Behaves as the corresponding sortation::SearchBisection overload.
+     * @tparam Record
+     *     Reference to the search instrumentation record.
+     */
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Evaluative,
+        Referential<Assortive<Evaluative>> Equate,
+        Referential<Assortive<Evaluative>> Order,
+        Referential<const Lineal<const Spatial, Positional, Natural, const Evaluative>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    SearchBisection(
+        Referential<const Spatial>
+            space,
+        Referential<const Evaluative>
+            value,
+        Referential<Positional>
+            position,
+        Natural
+            before,
+        Natural
+            after)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+#ifdef RAPBTL_INSTRUMENTATION
+        constexpr auto& Equated = Probe<Evaluative, Equate, Natural, Record>;
+        constexpr auto& Ordered = Probe<Evaluative, Order, Natural, Record>;
+        const Natural traversals = Record.traversals;
+        return Conclude<Natural, Record>(
+            ::sortation::SearchBisection(space, InstrumentedLiner<const Spatial, Positional, Natural, const Evaluative, Liner, Record>, value, position, before, after, Equated, Ordered),
+            traversals);
+#else
+        return ::sortation::SearchBisection<Spatial, Positional, Natural, Evaluative, Equate, Order, Liner>(space, value, position, before, after);
+#endif
+    }
+
+    /**
+     * @brief
+     *     Searches bisectionally for some value in a linear space while
+     *     recording the cost of the search.
+     * @details
+     *     Behaves as the corresponding sortation::SearchBisectionIteratively
+     *     overload.
+     * @tparam Record
+     *     Reference to the search instrumentation record.
+     */
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Evaluative,
+        Referential<Assortive<Evaluative>> Equate,
+        Referential<Assortive<Evaluative>> Order,
+        Referential<const Lineal<const Spatial, Positional, Natural, const Evaluative>> Liner,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    SearchBisectionIteratively(
+        Referential<const Spatial>
+            space,
+        Referential<const Evaluative>
+            value,
+        Referential<Positional>
+            position,
+        Referential<Natural>
+            before,
+        Referential<Natural>
+            after)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+#ifdef RAPBTL_INSTRUMENTATION
+        constexpr auto& Equated = Probe<Evaluative, Equate, Natural, Record>;
+        constexpr auto& Ordered = Probe<Evaluative, Order, Natural, Record>;
+        const Natural traversals = Record.traversals;
+        return Conclude<Natural, Record>(
+            ::sortation::SearchBisectionIteratively(space, InstrumentedLiner<const Spatial, Positional, Natural, const Evaluative, Liner, Record>, value, position, before, after, Equated, Ordered),
+            traversals);
+#else
+        return ::sortation::SearchBisectionIteratively<Spatial, Positional, Natural, Evaluative, Equate, Order, Liner>(space, value, position, before, after);
+#endif
+    }
+
+    /**
+     * @brief
+     *     Searches bisectionally for some value in a scalar space while
+     *     recording the cost of the search.
+     * @details
+     *     Behaves as the corresponding sortation::SearchScalarBisection
+     *     overload.
+     * @tparam Record
+     *     Reference to the search instrumentation record.
+     */
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Evaluative,
+        Referential<Assortive<Evaluative>> Equate,
+        Referential<Assortive<Evaluative>> Order,
+        Referential<const Scalar<const Spatial, Positional, Natural, const Evaluative>> Scale,
+        Referential<Instrumental<Natural>> Record>
+    static inline bool
+    SearchScalarBisection(
+        Referential<const Spatial>
+            space,
+        Referential<const Evaluative>
+            value,
+        Referential<Positional>
+            position,
+        Natural
+            extent)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+#ifdef RAPBTL_INSTRUMENTATION
+        constexpr auto& Equated = Probe<Evaluative, Equate, Natural, Record>;
+        constexpr auto& Ordered = Probe<Evaluative, Order, Natural, Record>;
+        const Natural traversals = Record.traversals;
+        return Conclude<Natural, Record>(
+            ::sortation::SearchScalarBisection(space, InstrumentedScale<const Spatial, Positional, Natural, const Evaluative, Scale, Record>, value, position, extent, Equated, Ordered),
+            traversals);
+#else
+        return ::sortation::SearchScalarBisection<Spatial, Positional, Natural, Evaluative, Equate, Order, Scale>(space, value, position, extent);
+#endif
+    }
+
+}
+
+}
+
+#endif
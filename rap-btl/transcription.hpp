@@ -0,0 +1,246 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef TRANSCRIPTION_MODULE
+#define TRANSCRIPTION_MODULE
+#include <location.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstring>
+#include <type_traits>
+#else
+extern "C" {
+#include <string.h>
+}
+#endif
+
+/**
+ * @brief
+ *     Numeric value to text transcription.
+ * @details
+ *     Conversion of integers from and to decimal text held in character
+ *     segments, intended for reading and writing large quantities of
+ *     integers without invoking formatted standard library input or output
+ *     functions for each value.
+ */
+namespace transcription {
+
+using ::location::Locational;
+using ::location::Referential;
+
+/**
+ * @brief
+ *     Determines whether a character is a decimal digit.
+ * @details
+ *     Independent of the current locale.
+ * @param[in] character
+ *     The character being examined.
+ * @return
+ *     Whether the character is a decimal digit.
+ */
+static inline bool
+IsDigit(char character)
+{
+    return static_cast<unsigned char>(character - '0') < 10;
+}
+
+/**
+ * @brief
+ *     Determines whether eight characters are all decimal digits.
+ * @details
+ *     The eight characters are examined at once as the bytes of a 64 bit
+ *     word which was copied from the text in memory order.
+ * @param[in] word
+ *     The eight characters as a little endian word.
+ * @return
+ *     Whether all eight characters are decimal digits.
+ */
+static inline bool
+AreEightDigits(unsigned long long word)
+{
+    return ((word & 0xF0F0F0F0F0F0F0F0ull) | (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+}
+
+/**
+ * @brief
+ *     Converts eight decimal digits at once.
+ * @details
+ *     Pairs of digits, then pairs of pairs, then pairs of quadruples are
+ *     combined with one multiplication each, instead of accumulating one
+ *     digit at a time.
+ * @param[in] word
+ *     The eight decimal digit characters as a little endian word.
+ * @return
+ *     The value of the eight digit decimal number.
+ */
+static inline unsigned long long
+ConvertEightDigits(unsigned long long word)
+{
+    word -= 0x3030303030303030ull;
+    word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FFull;
+    word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFFull;
+    return (word * 10000 + (word >> 32)) & 0xFFFFFFFFull;
+}
+
+/**
+ * @brief
+ *     Parses all of the decimal integers in a character segment.
+ * @details
+ *     Integers consist of an optional minus sign followed by one or more
+ *     decimal digits and may be separated by any other characters, which
+ *     are skipped.  Each integer is handed to the sink function object,
+ *     which must return false to stop parsing.  On little endian targets,
+ *     runs of eight digits are converted at once.  Values which do not fit
+ *     within the integral type wrap around as in unsigned arithmetic.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Integral
+ *     Type of the integers being parsed.
+ * @tparam Receptive
+ *     Type of the sink function object, which must be invocable with a
+ *     constant integer reference and return bool.
+ * @param[in] text
+ *     Pointer to the first character of the segment.
+ * @param[in] length
+ *     Number of characters in the segment.
+ * @param[in] sink
+ *     Reference to the sink function object.
+ * @return
+ *     Number of integers accepted by the sink.
+ */
+template <
+    typename Natural,
+    typename Integral,
+    typename Receptive>
+static inline Natural
+ParseIntegers(
+    const Locational<const char>
+        text,
+    Natural
+        length,
+    Referential<const Receptive>
+        sink)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        is_integral<Integral>::value,
+        "Integral:  Integer type required");
+    using Magnitude = typename make_unsigned<Integral>::type;
+#else
+    using Magnitude = unsigned long long;
+#endif
+    Natural index, count;
+    Magnitude magnitude;
+    Integral value;
+    bool negative;
+    index = count = 0;
+    while (index < length) {
+        if (!IsDigit(text[index])) {
+            index++;
+            continue;
+        }
+        negative = index > 0 && text[index - 1] == '-';
+        magnitude = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        while (length - index >= 8) {
+            unsigned long long word;
+            memcpy(&word, text + index, sizeof(word));
+            if (!AreEightDigits(word))
+                break;
+            magnitude = static_cast<Magnitude>(magnitude * 100000000u + ConvertEightDigits(word));
+            index += 8;
+        }
+#endif
+        while (index < length && IsDigit(text[index]))
+            magnitude = static_cast<Magnitude>(magnitude * 10u + static_cast<unsigned>(text[index++] - '0'));
+        value = static_cast<Integral>(negative ? 0u - magnitude : magnitude);
+        if (!sink(value))
+            break;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief
+ *     Formats an integer as decimal text.
+ * @details
+ *     Two digits are produced at a time using a table of digit pairs.  A
+ *     minus sign precedes negative values.  No terminating null character
+ *     is written.  The text must have room for at least three characters
+ *     per byte of the integral type plus one for the sign.
+ * @tparam Natural
+ *     Type of natural integer counts.
+ * @tparam Integral
+ *     Type of the integer being formatted.
+ * @param[in] value
+ *     The integer being formatted.
+ * @param[out] text
+ *     Pointer to the first character which receives the text.
+ * @return
+ *     Number of characters written.
+ */
+template <
+    typename Natural,
+    typename Integral>
+static inline Natural
+FormatInteger(
+    Integral
+        value,
+    const Locational<char>
+        text)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        is_integral<Integral>::value,
+        "Integral:  Integer type required");
+    using Magnitude = typename make_unsigned<Integral>::type;
+#else
+    using Magnitude = unsigned long long;
+#endif
+    static constexpr char Pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+    static constexpr Natural Width = sizeof(Integral) * 3 + 1;
+    char digits[Width];
+    Natural index, length;
+    Magnitude magnitude;
+    const bool negative = value < 0;
+    magnitude = negative ? static_cast<Magnitude>(0u - static_cast<Magnitude>(value)) : static_cast<Magnitude>(value);
+    index = Width;
+    while (magnitude >= 100) {
+        const unsigned pair = static_cast<unsigned>(magnitude % 100) * 2;
+        magnitude /= 100;
+        digits[--index] = Pairs[pair + 1];
+        digits[--index] = Pairs[pair];
+    }
+    if (magnitude >= 10) {
+        digits[--index] = Pairs[magnitude * 2 + 1];
+        digits[--index] = Pairs[magnitude * 2];
+    } else {
+        digits[--index] = static_cast<char>('0' + magnitude);
+    }
+    if (negative)
+        digits[--index] = '-';
+    length = Width - index;
+    memcpy(text, digits + index, length);
+    return length;
+}
+
+}
+
+#endif
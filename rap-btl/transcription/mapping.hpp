@@ -0,0 +1,123 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef TRANSCRIPTION_MAPPING_MODULE
+#define TRANSCRIPTION_MAPPING_MODULE
+#include <transcription.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+extern "C" {
+#include <fcntl.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+#endif
+
+namespace transcription {
+
+/**
+ * @brief
+ *     Memory mapped text input using the POSIX mmap function.
+ * @details
+ *     Maps the entire content of a file into memory for reading, so that it
+ *     can be parsed as one character segment without copying it through
+ *     standard library input buffers.
+ */
+namespace mapping {
+
+    /**
+     * @brief
+     *     Memory mapped file conformity.
+     * @details
+     *     Type definition which holds the address and length of a file
+     *     which has been mapped into memory.
+     */
+    struct Mapped {
+
+        Locational<const char>
+            text; /**< Address of the first character of the file. */
+
+        size_t
+            length; /**< Number of characters in the file. */
+    };
+
+    /**
+     * @brief
+     *     Maps a file into memory for reading.
+     * @details
+     *     The kernel is advised that the mapping will be read sequentially.
+     *     An empty file is mapped as a null text with zero length.  The file
+     *     descriptor is closed before returning, as the mapping remains
+     *     valid until it is unmapped.
+     * @param[out] mapping
+     *     Reference to the memory mapped file.
+     * @param[in] path
+     *     Pointer to the null terminated path of the file.
+     * @return
+     *     Whether the file was mapped.
+     */
+    static inline bool
+    Map(
+        Referential<Mapped>
+            mapping,
+        const Locational<const char>
+            path)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+#endif
+        struct stat status;
+        Locational<void> address;
+        const int descriptor = open(path, O_RDONLY);
+        mapping.text = 0;
+        mapping.length = 0;
+        if (descriptor < 0)
+            return false;
+        if (fstat(descriptor, &status) != 0) {
+            close(descriptor);
+            return false;
+        }
+        if (status.st_size > 0) {
+            address = mmap(0, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (address == MAP_FAILED) {
+                close(descriptor);
+                return false;
+            }
+            madvise(address, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+            mapping.text = static_cast<Locational<const char>>(address);
+            mapping.length = static_cast<size_t>(status.st_size);
+        }
+        close(descriptor);
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Unmaps a file from memory.
+     * @details
+     *     Afterwards the mapping holds a null text with zero length.
+     * @param[in,out] mapping
+     *     Reference to the memory mapped file.
+     * @return
+     *     Does not return any value.
+     */
+    static inline void
+    Unmap(Referential<Mapped> mapping)
+    {
+        if (mapping.text)
+            munmap(const_cast<Locational<char>>(mapping.text), mapping.length);
+        mapping.text = 0;
+        mapping.length = 0;
+    }
+
+}
+
+}
+
+#endif
@@ -0,0 +1,236 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef TRANSCRIPTION_STDIO_MODULE
+#define TRANSCRIPTION_STDIO_MODULE
+#include <transcription.hpp>
+#include <trajection.hpp>
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+#include <cstdio>
+#else
+extern "C" {
+#include <stdio.h>
+}
+#endif
+
+namespace transcription {
+
+/**
+ * @brief
+ *     Buffered text output using one of either the C or C++ standard
+ *     library file functions.
+ * @details
+ *     Integers are formatted directly into a large buffer which is written
+ *     to a file with a single fwrite call whenever it fills, rather than
+ *     formatting and writing each value with fprintf.
+ */
+namespace stdio {
+
+    using ::trajection::Directional;
+
+    /**
+     * @brief
+     *     Buffered text output conformity.
+     * @details
+     *     Type definition which holds the file being written along with the
+     *     text which is waiting to be written.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Capacity
+     *     Number of characters which the buffer holds.
+     */
+    template <
+        typename Natural,
+        Natural Capacity>
+    struct Transcriptive {
+
+        Locational<FILE>
+            handle; /**< File which receives the text. */
+
+        Natural
+            count; /**< Number of characters waiting in the buffer. */
+
+        char
+            buffer[Capacity]; /**< Text waiting to be written. */
+    };
+
+    /**
+     * @brief
+     *     Initializes buffered text output.
+     * @details
+     *     Must be invoked before any other function receives the output.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Capacity
+     *     Number of characters which the buffer holds.
+     * @param[out] writer
+     *     Reference to the buffered text output.
+     * @param[in] handle
+     *     Pointer to the file which receives the text.
+     * @return
+     *     Does not return any value.
+     */
+    template <
+        typename Natural,
+        Natural Capacity>
+    static inline void
+    Initialize(
+        Referential<Transcriptive<Natural, Capacity>>
+            writer,
+        const Locational<FILE>
+            handle)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        writer.handle = handle;
+        writer.count = 0;
+    }
+
+    /**
+     * @brief
+     *     Writes the buffered text to the file.
+     * @details
+     *     The buffer is empty afterwards, even if the write failed.  Must
+     *     be invoked once all of the text has been transcribed.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Capacity
+     *     Number of characters which the buffer holds.
+     * @param[in,out] writer
+     *     Reference to the buffered text output.
+     * @return
+     *     Whether all of the buffered text was written.
+     */
+    template <
+        typename Natural,
+        Natural Capacity>
+    static inline bool
+    Flush(Referential<Transcriptive<Natural, Capacity>> writer)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+#endif
+        const Natural count = writer.count;
+        writer.count = 0;
+        return fwrite(writer.buffer, 1, count, writer.handle) == count;
+    }
+
+    /**
+     * @brief
+     *     Transcribes an integer followed by a separator character.
+     * @details
+     *     The buffer is flushed first if it may not have room for the text.
+     * @tparam Natural
+     *     Type of natural integer counts.
+     * @tparam Capacity
+     *     Number of characters which the buffer holds.
+     * @tparam Integral
+     *     Type of the integer being transcribed.
+     * @param[in,out] writer
+     *     Reference to the buffered text output.
+     * @param[in] value
+     *     The integer being transcribed.
+     * @param[in] separator
+     *     The character which follows the integer.
+     * @return
+     *     Whether any flush which was required succeeded.
+     */
+    template <
+        typename Natural,
+        Natural Capacity,
+        typename Integral>
+    static inline bool
+    Transcribe(
+        Referential<Transcriptive<Natural, Capacity>>
+            writer,
+        Integral
+            value,
+        char
+            separator)
+    {
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+        using namespace ::std;
+        static_assert(
+            is_integral<Natural>::value && is_unsigned<Natural>::value,
+            "Natural:  Unsigned integer type required");
+#endif
+        static constexpr Natural Width = sizeof(Integral) * 3 + 2;
+        static_assert(Capacity >= Width, "Capacity:  Room for one integer required");
+        if (Capacity - writer.count < Width && !Flush(writer))
+            return false;
+        writer.count += FormatInteger<Natural>(value, writer.buffer + writer.count);
+        writer.buffer[writer.count++] = separator;
+        return true;
+    }
+
+    /**
+     * @brief
+     *     Transcribes all of the integers in a space.
+     * @details
+     *     The space is traversed from beginning to end using the specified
+     *     direction objective, and each integer is transcribed followed by
+     *     the separator character.  The buffer is not flushed at the end.
+     * @tparam Spatial
+     *     Type of the space.
+     * @tparam Positional
+     *     Type of positions within the space.
+     * @tparam Natural
+     *     Type of natural integer counts of the space.
+     * @tparam Integral
+     *     Type of the integers in the space.
+     * @tparam Transcriptional
+     *     Type of natural integer counts of the buffered text output.
+     * @tparam Capacity
+     *     Number of characters which the buffer holds.
+     * @param[in,out] writer
+     *     Reference to the buffered text output.
+     * @param[in] space
+     *     Reference to the space.
+     * @param[in] direction
+     *     Reference to the direction objective of the space.
+     * @param[in] separator
+     *     The character which follows each integer.
+     * @return
+     *     Whether every flush which was required succeeded.  An empty
+     *     space transcribes nothing and returns true.
+     */
+    template <
+        typename Spatial,
+        typename Positional,
+        typename Natural,
+        typename Integral,
+        typename Transcriptional,
+        Transcriptional Capacity>
+    static inline bool
+    TranscribeIntegers(
+        Referential<Transcriptive<Transcriptional, Capacity>>
+            writer,
+        Referential<const Spatial>
+            space,
+        Referential<const Directional<const Spatial, Positional, Natural, const Integral>>
+            direction,
+        char
+            separator)
+    {
+        Positional position;
+        if (!direction.begins(space, 0))
+            return true;
+        direction.scale.begin(space, position, 0);
+        while (true) {
+            if (!Transcribe(writer, direction.scale.go(space, position).to, separator))
+                return false;
+            if (!direction.traverses(space, position, 1))
+                break;
+            direction.scale.traverse(space, position, 1);
+        }
+        return true;
+    }
+
+}
+
+}
+
+#endif
@@ -0,0 +1,633 @@
+//  2019 Aaron Sami Abassi
+// Licensed under the Academic Free License version 3.0
+#ifndef TRANSFERENCE_MODULE
+#define TRANSFERENCE_MODULE
+#include <junction.hpp>
+#include <ration.hpp>
+#include <ration/consecution.hpp>
+#include <sortation.hpp>
+#include <trajection.hpp>
+
+/**
+ * @brief
+ *     Move based bulk transference between space families.
+ * @details
+ *     Moves whole spaces of elements between ration resources, junction
+ *     lists and segmentation arrays using rvalue assignment rather than
+ *     element by element copies.  Contiguous runs are moved using a
+ *     memory move function and sorted sources are collated into ordered
+ *     resources without per-element bisection.  Source spaces are left
+ *     holding moved-from elements and should be emptied by the caller,
+ *     typically by way of the secede function of the source family.
+ */
+namespace transference {
+
+using ::junction::ConnectNext;
+using ::junction::Instantiate;
+using ::junction::Junctive;
+using ::junction::Nodal;
+using ::junction::Reclaim;
+using ::location::Deferential;
+using ::location::Locational;
+using ::location::Referential;
+using ::ration::DeferElements;
+using ::ration::MemoryMoving;
+using ::ration::ReadPositional;
+using ::ration::Resourceful;
+using ::ration::consecution::ReadLiner;
+using ::sortation::Assortive;
+using ::sortation::SearchBisection;
+using ::trajection::Directional;
+
+/**
+ * @brief
+ *     Moves a contiguous run to the end of a resource.
+ * @details
+ *     Moves count elements from a contiguous run, such as a segmentation
+ *     array or the source array of another resource, to the end of the
+ *     allotted elements of the resource using a single call to the
+ *     specified memory move function.
+ * @tparam Natural
+ *     Type of natural integer used to track allotments.
+ * @tparam Length
+ *     The maximum number of elements in the resource.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Move
+ *     Function used to move the run into the resource array.
+ * @param[in,out] resource
+ *     Resource to receive the run.
+ * @param[in,out] run
+ *     Position of the first element of the run.
+ * @param[in] count
+ *     Number of elements in the run.
+ * @return
+ *     True if the run was moved, false if the resource lacked capacity.
+ */
+template <
+    typename Natural,
+    Natural Length,
+    typename Elemental,
+    Referential<MemoryMoving<Natural, Elemental>> Move>
+static inline bool
+ProceedRun(
+    Referential<Resourceful<Natural, Length, Elemental>>
+        resource,
+    Locational<Elemental>
+        run,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (Length - resource.allotment < count)
+        return false;
+    if (!Move(run, resource.source + resource.allotment, count))
+        return false;
+    resource.allotment += count;
+    return true;
+}
+
+/**
+ * @brief
+ *     Moves all elements of a resource into a contiguous run.
+ * @details
+ *     Moves every allotted element of the resource into the run using a
+ *     single call to the specified memory move function and resets the
+ *     allotment of the resource.  The run must have room for at least as
+ *     many elements as are allotted in the resource.
+ * @tparam Natural
+ *     Type of natural integer used to track allotments.
+ * @tparam Length
+ *     The maximum number of elements in the resource.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Move
+ *     Function used to move the resource array into the run.
+ * @param[in,out] resource
+ *     Resource to deliver.
+ * @param[out] run
+ *     Position of the first element of the run.
+ * @return
+ *     True if the elements were moved.
+ */
+template <
+    typename Natural,
+    Natural Length,
+    typename Elemental,
+    Referential<MemoryMoving<Natural, Elemental>> Move>
+static inline bool
+DeliverResource(
+    Referential<Resourceful<Natural, Length, Elemental>>
+        resource,
+    Locational<Elemental>
+        run)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    if (!Move(resource.source, run, resource.allotment))
+        return false;
+    resource.allotment = 0;
+    return true;
+}
+
+/**
+ * @brief
+ *     Moves all elements of a space into a contiguous run.
+ * @details
+ *     Trajects the whole space in the specified direction, moving each
+ *     element into consecutive positions of the run.  The run must have
+ *     room for at least as many elements as the direction surveys.
+ * @tparam Natural
+ *     Type of natural integer.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Spatial
+ *     Type of the source space.
+ * @tparam Positional
+ *     Type of position within the source space.
+ * @tparam RelativeNatural
+ *     Type of natural integer used by the source space.
+ * @param[out] run
+ *     Position of the first element of the run.
+ * @param[in] direction
+ *     Modifiable direction used to traject the source space.
+ * @param[in,out] space
+ *     Source space.
+ * @return
+ *     Number of elements moved.
+ */
+template <
+    typename Natural,
+    typename Elemental,
+    typename Spatial,
+    typename Positional,
+    typename RelativeNatural>
+static inline Natural
+DeliverRun(
+    Locational<Elemental>
+        run,
+    Referential<const Directional<Spatial, Positional, RelativeNatural, Elemental>>
+        direction,
+    Referential<Spatial>
+        space)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+        "RelativeNatural:  Unsigned integer type required");
+#endif
+    static const RelativeNatural Next = 1;
+    const Natural count = direction.survey(space);
+    Positional position;
+    if (count < 1)
+        return 0;
+    direction.scale.begin(space, position, 0);
+    for (Natural index = 0; index < count; index++) {
+        if (index > 0)
+            direction.scale.traverse(space, position, Next);
+        run[index] = static_cast<Deferential<Elemental>>(direction.scale.go(space, position).to);
+    }
+    return count;
+}
+
+/**
+ * @brief
+ *     Moves all elements of a space to the end of a resource.
+ * @details
+ *     Trajects the whole source space in the specified direction, moving
+ *     each element to the end of the allotted elements of the resource.
+ *     The capacity of the resource is verified once before any element is
+ *     moved.
+ * @tparam Natural
+ *     Type of natural integer used to track allotments.
+ * @tparam Length
+ *     The maximum number of elements in the resource.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Spatial
+ *     Type of the source space.
+ * @tparam Positional
+ *     Type of position within the source space.
+ * @tparam RelativeNatural
+ *     Type of natural integer used by the source space.
+ * @param[in,out] resource
+ *     Resource to receive the elements.
+ * @param[in] direction
+ *     Modifiable direction used to traject the source space.
+ * @param[in,out] space
+ *     Source space.
+ * @return
+ *     True if the elements were moved, false if the resource lacked
+ *     capacity.
+ */
+template <
+    typename Natural,
+    Natural Length,
+    typename Elemental,
+    typename Spatial,
+    typename Positional,
+    typename RelativeNatural>
+static inline bool
+ProceedResource(
+    Referential<Resourceful<Natural, Length, Elemental>>
+        resource,
+    Referential<const Directional<Spatial, Positional, RelativeNatural, Elemental>>
+        direction,
+    Referential<Spatial>
+        space)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    const RelativeNatural count = direction.survey(space);
+    if (Length - resource.allotment < count)
+        return false;
+    resource.allotment += DeliverRun<Natural>(resource.source + resource.allotment, direction, space);
+    return true;
+}
+
+/**
+ * @brief
+ *     Moves all elements of a space to the end of a list.
+ * @details
+ *     Instantiates enough unused nodes for the whole source space, then
+ *     trajects the source in the specified direction, moving each element
+ *     into a reclaimed node.  The new nodes are linked together before
+ *     being appended to the list as a single chain.
+ * @tparam Connective
+ *     Type of node link.
+ * @tparam Natural
+ *     Type of natural integer used to count nodes.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Adjunct
+ *     Allocator used to instantiate nodes.
+ * @tparam Spatial
+ *     Type of the source space.
+ * @tparam Positional
+ *     Type of position within the source space.
+ * @tparam RelativeNatural
+ *     Type of natural integer used by the source space.
+ * @param[in,out] list
+ *     List to receive the elements.
+ * @param[in] direction
+ *     Modifiable direction used to traject the source space.
+ * @param[in,out] space
+ *     Source space.
+ * @return
+ *     True if the elements were moved, false if nodes could not be
+ *     instantiated.
+ */
+template <
+    typename Connective,
+    typename Natural,
+    typename Elemental,
+    Referential<const ::junction::Adjunctive<Connective, Natural, Elemental>> Adjunct,
+    typename Spatial,
+    typename Positional,
+    typename RelativeNatural>
+static inline bool
+ProceedList(
+    Referential<Junctive<Connective, Natural, Elemental>>
+        list,
+    Referential<const Directional<Spatial, Positional, RelativeNatural, Elemental>>
+        direction,
+    Referential<Spatial>
+        space)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+        "RelativeNatural:  Unsigned integer type required");
+#endif
+    using NodeLocational = Locational<Nodal<Connective, Elemental>>;
+    static const RelativeNatural Next = 1;
+    const Natural count = direction.survey(space);
+    NodeLocational first, last, node;
+    Positional position;
+    if (count < 1)
+        return true;
+    if (!Instantiate<Connective, Natural, Elemental, Adjunct>(list, count))
+        return false;
+    first = last = 0;
+    direction.scale.begin(space, position, 0);
+    for (Natural index = 0; index < count; index++) {
+        if (index > 0)
+            direction.scale.traverse(space, position, Next);
+        node = Reclaim(list);
+        node->link = Connective();
+        node->element = static_cast<Deferential<Elemental>>(direction.scale.go(space, position).to);
+        if (last)
+            ConnectNext(last, node);
+        else
+            first = node;
+        last = node;
+    }
+    if (list.last)
+        ConnectNext(list.last, first);
+    else
+        list.first = first;
+    list.last = last;
+    list.count += count;
+    return true;
+}
+
+/**
+ * @brief
+ *     Collates a sequence of elements into an ordered resource.
+ * @details
+ *     Moves count elements, obtained in order from the next function, into
+ *     an ordered resource which contains no duplicates, omitting elements
+ *     equal to an element already in the resource.  A sorted sequence is
+ *     merged in one linear pass: the resource is first shifted up by count
+ *     elements with the memory move function, merged forward into its own
+ *     front and then shifted down over the remaining gap.  An unsorted
+ *     sequence is inserted element by element at the position found by
+ *     bisection.  A sorted sequence must be strictly ascending according to
+ *     the order function.  Capacity for the whole sequence must have been
+ *     verified by the caller.
+ * @tparam Natural
+ *     Type of natural integer used to track allotments.
+ * @tparam Length
+ *     The maximum number of elements in the resource.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Equate
+ *     Function used to determine if two elements are equal.
+ * @tparam Order
+ *     Function used to determine if two elements are in order.
+ * @tparam Move
+ *     Function used to move contiguous runs of elements.
+ * @tparam Sorted
+ *     Whether the sequence is known to be in strictly ascending order.
+ * @tparam Sequential
+ *     Type of the function which returns a reference to each element.
+ * @param[in,out] set
+ *     Ordered resource to receive the elements.
+ * @param[in] count
+ *     Number of elements in the sequence.
+ * @param[in] next
+ *     Function which returns a modifiable reference to the next element.
+ * @return
+ *     True if the sequence was collated, false if the move function failed.
+ */
+template <
+    typename Natural,
+    Natural Length,
+    typename Elemental,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order,
+    Referential<MemoryMoving<Natural, Elemental>> Move,
+    const bool Sorted,
+    typename Sequential>
+static inline bool
+CollateElements(
+    Referential<Resourceful<Natural, Length, Elemental>>
+        set,
+    const Natural
+        count,
+    Referential<const Sequential>
+        next)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    static auto& Liner = ReadLiner<Natural, Length, Elemental>;
+    static const Natural Before = 0;
+    ReadPositional<Elemental> position;
+    if (Sorted) {
+        const Natural allotment = set.allotment, end = count + allotment;
+        Natural from = count, to = 0;
+        if (!Move(set.source, set.source + count, allotment))
+            return false;
+        for (Natural index = 0; index < count; index++) {
+            Referential<Elemental> element = next();
+            while (from < end && Order(set.source[from], element)) {
+                if (from != to)
+                    set.source[to] = static_cast<Deferential<Elemental>>(set.source[from]);
+                from++;
+                to++;
+            }
+            if (from < end && Equate(set.source[from], element))
+                continue;
+            set.source[to++] = static_cast<Deferential<Elemental>>(element);
+        }
+        if (from != to && !Move(set.source + from, set.source + to, end - from))
+            return false;
+        set.allotment = to + end - from;
+        return true;
+    }
+    for (Natural index = 0; index < count; index++) {
+        Referential<Elemental> element = next();
+        Natural low = 0;
+        if (set.allotment > 0) {
+            Liner.increment.begin(set, position, 0);
+            if (SearchBisection(set, Liner, static_cast<Referential<const Elemental>>(element), position, Before, (Natural)(set.allotment - 1), Equate, Order))
+                continue;
+            low = position - set.source;
+            if (Order(*position, element))
+                low++;
+        }
+        if (!Move(set.source + low, set.source + low + 1, set.allotment - low))
+            return false;
+        set.source[low] = static_cast<Deferential<Elemental>>(element);
+        set.allotment++;
+    }
+    return true;
+}
+
+/**
+ * @brief
+ *     Collates a contiguous run into an ordered resource.
+ * @details
+ *     Moves the elements of a contiguous run into an ordered resource
+ *     which contains no duplicates, omitting run elements equal to an
+ *     element already in the resource.  When the run is known to be
+ *     sorted and every element of the resource orders before the first
+ *     run element, the run is moved with a single call to the memory move
+ *     function and no elements are compared.  Otherwise a sorted run is
+ *     merged in one linear pass and an unsorted run is inserted element by
+ *     element using bisection.  A sorted run must be strictly ascending
+ *     according to the order function.  Capacity for the whole run is
+ *     verified before any element is moved.
+ * @tparam Natural
+ *     Type of natural integer used to track allotments.
+ * @tparam Length
+ *     The maximum number of elements in the resource.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Equate
+ *     Function used to determine if two elements are equal.
+ * @tparam Order
+ *     Function used to determine if two elements are in order.
+ * @tparam Move
+ *     Function used to move contiguous runs of elements.
+ * @tparam Sorted
+ *     Whether the run is known to be in strictly ascending order.
+ * @param[in,out] set
+ *     Ordered resource to receive the run.
+ * @param[in,out] run
+ *     Position of the first element of the run.  The elements are left
+ *     moved-from.
+ * @param[in] count
+ *     Number of elements in the run.
+ * @return
+ *     True if the run was collated, false if the resource lacked capacity.
+ */
+template <
+    typename Natural,
+    Natural Length,
+    typename Elemental,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order,
+    Referential<MemoryMoving<Natural, Elemental>> Move,
+    const bool Sorted>
+static inline bool
+CollateRun(
+    Referential<Resourceful<Natural, Length, Elemental>>
+        set,
+    Locational<Elemental>
+        run,
+    Referential<const Natural>
+        count)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+#endif
+    const Natural allotment = set.allotment;
+    if (count < 1)
+        return true;
+    if (Length - allotment < count)
+        return false;
+    if (Sorted && (allotment < 1 || Order(set.source[allotment - 1], run[0])))
+        return ProceedRun<Natural, Length, Elemental, Move>(set, run, count);
+    Natural index = 0;
+    auto next = [&run, &index]() -> Referential<Elemental> {
+        return run[index++];
+    };
+    return CollateElements<Natural, Length, Elemental, Equate, Order, Move, Sorted>(set, count, next);
+}
+
+/**
+ * @brief
+ *     Collates all elements of a space into an ordered resource.
+ * @details
+ *     Moves the elements of any modifiable directional space, such as a
+ *     junction list, into an ordered resource which contains no
+ *     duplicates, omitting elements equal to an element already in the
+ *     resource.  When the source is known to be sorted and every element
+ *     of the resource orders before the first source element, the source
+ *     is appended without comparing elements.  Otherwise a sorted source
+ *     is merged in one linear pass, shifting the resource with the memory
+ *     move function, and an unsorted source is inserted element by
+ *     element using bisection.  A sorted source must be strictly
+ *     ascending according to the order function.  Capacity for the whole
+ *     source is verified before any element is moved.
+ * @tparam Natural
+ *     Type of natural integer used to track allotments.
+ * @tparam Length
+ *     The maximum number of elements in the resource.
+ * @tparam Elemental
+ *     Type of the elements.
+ * @tparam Spatial
+ *     Type of the source space.
+ * @tparam Positional
+ *     Type of position within the source space.
+ * @tparam RelativeNatural
+ *     Type of natural integer used by the source space.
+ * @tparam Equate
+ *     Function used to determine if two elements are equal.
+ * @tparam Order
+ *     Function used to determine if two elements are in order.
+ * @tparam Move
+ *     Function used to move contiguous runs of elements.
+ * @tparam Sorted
+ *     Whether the source is known to be in strictly ascending order.
+ * @param[in,out] set
+ *     Ordered resource to receive the elements.
+ * @param[in] direction
+ *     Modifiable direction used to traject the source space.
+ * @param[in,out] space
+ *     Source space.
+ * @return
+ *     True if the source was collated, false if the resource lacked
+ *     capacity.
+ */
+template <
+    typename Natural,
+    Natural Length,
+    typename Elemental,
+    typename Spatial,
+    typename Positional,
+    typename RelativeNatural,
+    Referential<Assortive<Elemental>> Equate,
+    Referential<Assortive<Elemental>> Order,
+    Referential<MemoryMoving<Natural, Elemental>> Move,
+    const bool Sorted>
+static inline bool
+CollateResource(
+    Referential<Resourceful<Natural, Length, Elemental>>
+        set,
+    Referential<const Directional<Spatial, Positional, RelativeNatural, Elemental>>
+        direction,
+    Referential<Spatial>
+        space)
+{
+#ifndef RAPBTL_NO_STD_CPLUSPLUS
+    using namespace ::std;
+    static_assert(
+        is_integral<Natural>::value && is_unsigned<Natural>::value,
+        "Natural:  Unsigned integer type required");
+    static_assert(
+        is_integral<RelativeNatural>::value && is_unsigned<RelativeNatural>::value,
+        "RelativeNatural:  Unsigned integer type required");
+#endif
+    static const RelativeNatural Next = 1;
+    const Natural allotment = set.allotment, count = direction.survey(space);
+    Positional position;
+    if (count < 1)
+        return true;
+    if (Length - allotment < count)
+        return false;
+    direction.scale.begin(space, position, 0);
+    if (Sorted && (allotment < 1 || Order(set.source[allotment - 1], direction.scale.go(space, position).to)))
+        return ProceedResource(set, direction, space);
+    bool first = true;
+    auto next = [&direction, &space, &position, &first]() -> Referential<Elemental> {
+        if (!first)
+            direction.scale.traverse(space, position, Next);
+        first = false;
+        return direction.scale.go(space, position).to;
+    };
+    return CollateElements<Natural, Length, Elemental, Equate, Order, Move, Sorted>(set, count, next);
+}
+
+}
+
+#endif